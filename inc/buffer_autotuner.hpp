@@ -0,0 +1,107 @@
+#ifndef SOCKETS_BUFFER_AUTOTUNER_HPP
+#define SOCKETS_BUFFER_AUTOTUNER_HPP
+
+#include "socket_error.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Resizes kernel send and receive buffers of connected sockets from measured throughput and round trip time.
+     * For InetSocket buffer is sized to twice the bandwidth delay product estimated from TCP_INFO, for IpcSocket it grows while queue is nearly full.
+     * Idle connections are shrunk to minimum size, so memory is given to busy ones. Sum of buffers of all sockets is kept within memory cap,
+     * when needs exceed it, all buffers are scaled down proportionally. Kernel does not autotune buffers of added sockets after first tune(). Object is not thread safe
+     */
+    class BufferAutotuner {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_memory_cap uint64_t maximum total kernel memory of buffers of all sockets. Default is 256 MiB
+         * \param p_min_buffer_size uint32_t minimum requested size of each buffer. Default is 64 KiB
+         * \param p_max_buffer_size uint32_t maximum requested size of each buffer. Kernel additionally limits it with net.core.wmem_max and net.core.rmem_max. Default is 16 MiB
+         */
+        explicit BufferAutotuner(uint64_t p_memory_cap = 256 * 1024 * 1024,
+                                 uint32_t p_min_buffer_size = 64 * 1024,
+                                 uint32_t p_max_buffer_size = 16 * 1024 * 1024);
+
+        /**
+         * \brief Starts tuning buffers of the socket
+         * \tparam Socket InetSocket or IpcSocket
+         * \param p_socket Socket&. Connected socket, should be removed before it is closed
+         */
+        template < class Socket > void add(Socket& p_socket) { BufferAutotuner::addHandle(p_socket.nativeHandle()); }
+
+        /**
+         * \brief Stops tuning buffers of the socket. Buffers keep their current size
+         * \tparam Socket InetSocket or IpcSocket
+         * \param p_socket Socket&
+         */
+        template < class Socket > void remove(Socket& p_socket) { BufferAutotuner::removeHandle(p_socket.nativeHandle()); }
+
+        /**
+         * \brief Samples all sockets and resizes buffers which size differs significantly from the estimated need.
+         * Should be called periodically, e.g. every few round trip times
+         * \return uint64_t number of resized buffers
+         */
+        auto tune() -> uint64_t;
+
+        /**
+         * \brief Returns total kernel memory of buffers of all sockets
+         * \return uint64_t
+         */
+        [[nodiscard]] auto memoryInUse() const noexcept -> uint64_t;
+        /**
+         * \brief Returns memory cap
+         * \return uint64_t
+         */
+        [[nodiscard]] auto memoryCap() const noexcept -> uint64_t;
+        /**
+         * \brief Returns number of tuned sockets
+         * \return uint64_t
+         */
+        [[nodiscard]] auto socketCount() const noexcept -> uint64_t;
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code;
+
+    private:
+        struct Buffer {
+            uint64_t requested = 0;
+            uint64_t allocated = 0;
+            uint64_t target = 0;
+            bool managed = false;
+        };
+
+        struct Connection {
+            int32_t socket = -1;
+            Buffer send;
+            Buffer receive;
+            uint64_t bytes_acked = 0;
+            uint64_t bytes_received = 0;
+            std::chrono::steady_clock::time_point sampled;
+        };
+
+        std::vector< Connection > m_connections;
+
+        std::error_code m_error;
+
+        uint64_t m_memory_cap;
+        uint64_t m_memory_in_use;
+        uint32_t m_min_buffer_size;
+        uint32_t m_max_buffer_size;
+
+        void addHandle(int32_t p_socket);
+        void removeHandle(int32_t p_socket);
+        void sample(Connection& p_connection, std::chrono::steady_clock::time_point p_now);
+        auto resize(int32_t p_socket, int32_t p_option, Buffer& p_buffer) -> bool;
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_BUFFER_AUTOTUNER_HPP
@@ -0,0 +1,349 @@
+#ifndef SOCKETS_COMPRESSED_STREAM_HPP
+#define SOCKETS_COMPRESSED_STREAM_HPP
+
+#include "compressor.hpp"
+#include "framer.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <system_error>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Statistics of compressed stream
+     */
+    struct CompressionStats {
+        /**
+         * \brief Number of sent messages which were compressed
+         */
+        uint64_t messages_compressed = 0;
+        /**
+         * \brief Number of sent messages which were sent as is
+         */
+        uint64_t messages_raw = 0;
+        /**
+         * \brief Size of sent messages before compression
+         */
+        uint64_t bytes_original = 0;
+        /**
+         * \brief Size of sent messages on the wire excluding frame prefix
+         */
+        uint64_t bytes_wire = 0;
+        /**
+         * \brief Time spent in compressor
+         */
+        std::chrono::nanoseconds compression_time{0};
+        /**
+         * \brief Time spent in decompressor
+         */
+        std::chrono::nanoseconds decompression_time{0};
+
+        /**
+         * \brief Returns compression ratio of sent data
+         * \return double. bytes_original / bytes_wire
+         */
+        [[nodiscard]] auto ratio() const noexcept -> double {
+            return bytes_wire == 0 ? 1.0 : static_cast< double >(bytes_original) / static_cast< double >(bytes_wire);
+        }
+    };
+
+    /**
+     * \brief Message stream over InetSocket or IpcSocket which compresses messages transparently.
+     * Each message is carried in a length prefixed frame which payload starts with algorithm byte.
+     * Compressed payload is preceded by the varint size of original message.
+     * Messages smaller than threshold or which do not shrink are sent as is.
+     * \tparam Socket InetSocket or IpcSocket
+     */
+    template < class Socket > class CompressedStream {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_socket Socket&. Should outlive the stream
+         * \param p_compressor std::unique_ptr< Compressor >. May be nullptr, then messages are sent uncompressed and only uncompressed messages are accepted
+         * \param p_min_compress_size uint64_t messages smaller than this are not compressed. Default is 256
+         * \param p_max_message_size uint64_t. Default is 16 MiB
+         * \param p_prefix FramePrefix. Default is FramePrefix::FIXED_32
+         * \param p_integrity FrameIntegrity. Default is FrameIntegrity::NONE
+         */
+        explicit CompressedStream(Socket& p_socket,
+                                  std::unique_ptr< Compressor > p_compressor,
+                                  uint64_t p_min_compress_size = 256,
+                                  uint64_t p_max_message_size = 16 * 1024 * 1024,
+                                  FramePrefix p_prefix = FramePrefix::FIXED_32,
+                                  FrameIntegrity p_integrity = FrameIntegrity::NONE) :
+            m_framer(p_socket, p_prefix, p_max_message_size + max_header_size, p_integrity),
+            m_compressor(std::move(p_compressor)),
+            m_min_compress_size(p_min_compress_size),
+            m_max_message_size(p_max_message_size) { }
+
+        CompressedStream(const CompressedStream&) = delete;
+        CompressedStream(CompressedStream&&) = delete;
+        CompressedStream& operator=(const CompressedStream&) = delete;
+        CompressedStream& operator=(CompressedStream&&) = delete;
+        ~CompressedStream() = default;
+
+        /**
+         * \brief Compresses message if it is worth it and appends it to the send buffer without sending
+         * \param p_message std::span< const uint8_t >
+         */
+        void queueMessage(std::span< const uint8_t > p_message) {
+            if (p_message.size() > m_max_message_size) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::FRAME_TOO_LARGE);
+                return;
+            }
+            uint8_t l_header[max_header_size];
+            l_header[0] = static_cast< uint8_t >(CompressionAlgorithm::NONE);
+            uint8_t l_header_size = 1;
+            auto l_body = p_message;
+            if (m_compressor && p_message.size() >= m_min_compress_size) {
+                auto l_compressed_header_size = static_cast< uint8_t >(1 + FrameParser::encodePrefix(FramePrefix::VARINT, p_message.size(), l_header + 1));
+                m_compressed.resize(m_compressor->bound(p_message.size()));
+                auto l_start = std::chrono::steady_clock::now();
+                auto l_compressed_size = m_compressor->compress(p_message, m_compressed);
+                m_stats.compression_time += std::chrono::steady_clock::now() - l_start;
+                if (l_compressed_size > 0 && l_compressed_size + l_compressed_header_size < p_message.size() + 1) {
+                    l_header[0] = static_cast< uint8_t >(m_compressor->algorithm());
+                    l_header_size = l_compressed_header_size;
+                    l_body = std::span< const uint8_t >(m_compressed.data(), l_compressed_size);
+                }
+            }
+            m_framer.queueFrame({l_header, l_header_size}, l_body);
+            if (m_framer.error()) {
+                m_error = m_framer.error();
+                m_framer.resetError();
+                return;
+            }
+            if (l_header[0] == static_cast< uint8_t >(CompressionAlgorithm::NONE)) {
+                ++m_stats.messages_raw;
+            } else {
+                ++m_stats.messages_compressed;
+            }
+            m_stats.bytes_original += p_message.size();
+            m_stats.bytes_wire += l_header_size + l_body.size();
+        }
+
+        /**
+         * \brief Sends queued messages.
+         * In non blocking mode data which was not accepted by socket is kept and sent on next flush
+         * \return uint64_t number of bytes sent
+         */
+        auto flush() -> uint64_t {
+            CompressedStream::clearTryAgain();
+            auto l_bytes_sent = m_framer.flush();
+            if (m_framer.error()) {
+                m_error = m_framer.error();
+                m_framer.resetError();
+            }
+            return l_bytes_sent;
+        }
+
+        /**
+         * \brief Queues message and sends send buffer.
+         * Message stays queued when socket would block, so it should not be written again after 0 is returned with tristan::sockets::Error::WRITE_TRY_AGAIN
+         * \param p_message std::span< const uint8_t >
+         * \return uint64_t number of bytes sent
+         */
+        auto writeMessage(std::span< const uint8_t > p_message) -> uint64_t {
+            CompressedStream::clearTryAgain();
+            if (m_error) {
+                return 0;
+            }
+            CompressedStream::queueMessage(p_message);
+            if (m_error) {
+                return 0;
+            }
+            return CompressedStream::flush();
+        }
+
+        /**
+         * \brief Receives data with single read call and returns all complete messages.
+         * Size of decompressed messages returned by one call is limited by maximum message size.
+         * Frames beyond the limit are kept and returned by the next calls, which do not read from socket while bufferedSize() is not 0
+         * \return std::span< const std::span< const uint8_t > >. Views are valid until next call to readMessages().
+         * Uncompressed messages point into receive buffer, decompressed ones into internal buffer reused between calls
+         */
+        [[nodiscard]] auto readMessages() -> std::span< const std::span< const uint8_t > > {
+            m_messages.clear();
+            CompressedStream::clearTryAgain();
+            if (m_error) {
+                return {};
+            }
+            std::span< const std::span< const uint8_t > > l_frames;
+            std::error_code l_read_error;
+            if (m_deferred_sizes.empty()) {
+                l_frames = m_framer.readFrames();
+                l_read_error = m_framer.error();
+                m_framer.resetError();
+            } else {
+                std::swap(m_current, m_deferred);
+                m_deferred.clear();
+                m_current_frames.clear();
+                uint64_t l_offset = 0;
+                for (auto l_size: m_deferred_sizes) {
+                    m_current_frames.emplace_back(m_current.data() + l_offset, l_size);
+                    l_offset += l_size;
+                }
+                m_deferred_sizes.clear();
+                l_frames = m_current_frames;
+                l_read_error = m_deferred_error;
+                m_deferred_error = {};
+            }
+            uint64_t l_decoded_size = 0;
+            size_t l_count = 0;
+            for (; l_count < l_frames.size(); ++l_count) {
+                auto l_header = CompressedStream::parseHeader(l_frames[l_count]);
+                if (m_error) {
+                    return {};
+                }
+                if (l_count > 0 && l_decoded_size + l_header.original_size > m_max_message_size) {
+                    break;
+                }
+                l_decoded_size += l_header.original_size;
+            }
+            for (auto l_frame: l_frames.subspan(l_count)) {
+                m_deferred.insert(m_deferred.end(), l_frame.begin(), l_frame.end());
+                m_deferred_sizes.push_back(l_frame.size());
+            }
+            m_decoded.resize(l_decoded_size);
+            uint64_t l_offset = 0;
+            for (auto l_frame: l_frames.first(l_count)) {
+                auto l_header = CompressedStream::parseHeader(l_frame);
+                auto l_payload = l_frame.subspan(l_header.size);
+                if (l_frame[0] == static_cast< uint8_t >(CompressionAlgorithm::NONE)) {
+                    m_messages.push_back(l_payload);
+                    continue;
+                }
+                std::span< uint8_t > l_destination(m_decoded.data() + l_offset, l_header.original_size);
+                auto l_start = std::chrono::steady_clock::now();
+                auto l_success = m_compressor->decompress(l_payload, l_destination);
+                m_stats.decompression_time += std::chrono::steady_clock::now() - l_start;
+                if (not l_success) {
+                    m_error = tristan::sockets::makeError(tristan::sockets::Error::DECOMPRESSION_FAILED);
+                    m_messages.clear();
+                    return {};
+                }
+                m_messages.emplace_back(l_destination);
+                l_offset += l_header.original_size;
+            }
+            if (m_deferred_sizes.empty()) {
+                m_error = l_read_error;
+            } else {
+                m_deferred_error = l_read_error;
+            }
+            return m_messages;
+        }
+
+        /**
+         * \brief Returns size of received frames which were kept for the next call to readMessages()
+         * \return uint64_t
+         */
+        [[nodiscard]] auto bufferedSize() const noexcept -> uint64_t { return m_deferred.size(); }
+
+        /**
+         * \brief Returns number of queued bytes which were not sent yet
+         * \return uint64_t
+         */
+        [[nodiscard]] auto pendingWriteSize() const noexcept -> uint64_t { return m_framer.pendingWriteSize(); }
+
+        /**
+         * \brief Returns statistics
+         * \return const CompressionStats&
+         */
+        [[nodiscard]] auto stats() const noexcept -> const CompressionStats& { return m_stats; }
+
+        /**
+         * \brief Returns compressor
+         * \return Compressor*. nullptr if stream is not compressed
+         */
+        [[nodiscard]] auto compressor() const noexcept -> Compressor* { return m_compressor.get(); }
+
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code { return m_error; }
+
+        /**
+         * \brief Resets error to tristan::socket::Error::SUCCESS
+         */
+        void resetError() { m_error = m_framer.parser().error(); }
+
+    private:
+        /**
+         * \brief Maximum size of message header: algorithm byte and varint size
+         */
+        static constexpr uint8_t max_header_size = 1 + FrameParser::max_prefix_size;
+
+        struct Header {
+            uint64_t original_size;
+            uint8_t size;
+        };
+
+        Framer< Socket > m_framer;
+
+        std::unique_ptr< Compressor > m_compressor;
+
+        std::vector< uint8_t > m_compressed;
+        std::vector< uint8_t > m_decoded;
+        std::vector< std::span< const uint8_t > > m_messages;
+        std::vector< uint8_t > m_deferred;
+        std::vector< uint64_t > m_deferred_sizes;
+        std::vector< uint8_t > m_current;
+        std::vector< std::span< const uint8_t > > m_current_frames;
+
+        CompressionStats m_stats;
+
+        std::error_code m_error;
+        std::error_code m_deferred_error;
+
+        uint64_t m_min_compress_size;
+        uint64_t m_max_message_size;
+
+        // Error which only reported that socket would block should not stop the next read or write
+        void clearTryAgain() {
+            if (m_error == tristan::sockets::makeError(tristan::sockets::Error::READ_TRY_AGAIN)
+                || m_error == tristan::sockets::makeError(tristan::sockets::Error::WRITE_TRY_AGAIN)) {
+                m_error = {};
+            }
+        }
+
+        auto parseHeader(std::span< const uint8_t > p_frame) -> Header {
+            if (p_frame.empty()) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::DECOMPRESSION_FAILED);
+                return {0, 0};
+            }
+            if (p_frame[0] == static_cast< uint8_t >(CompressionAlgorithm::NONE)) {
+                return {0, 1};
+            }
+            if (not m_compressor || p_frame[0] != static_cast< uint8_t >(m_compressor->algorithm())) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::COMPRESSION_UNSUPPORTED_ALGORITHM);
+                return {0, 0};
+            }
+            uint64_t l_size = 0;
+            for (uint8_t i = 1; i < p_frame.size() && i < max_header_size; ++i) {
+                l_size |= static_cast< uint64_t >(p_frame[i] & 0x7F) << (7 * (i - 1));
+                if ((p_frame[i] & 0x80) == 0) {
+                    if (l_size > m_max_message_size) {
+                        m_error = tristan::sockets::makeError(tristan::sockets::Error::FRAME_TOO_LARGE);
+                        return {0, 0};
+                    }
+                    // Sender compresses only messages which shrink, so payload which is empty or not smaller than claimed size is forged
+                    if (p_frame.size() == i + 1u || p_frame.size() - (i + 1u) >= l_size) {
+                        m_error = tristan::sockets::makeError(tristan::sockets::Error::DECOMPRESSION_FAILED);
+                        return {0, 0};
+                    }
+                    return {l_size, static_cast< uint8_t >(i + 1)};
+                }
+            }
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::DECOMPRESSION_FAILED);
+            return {0, 0};
+        }
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_COMPRESSED_STREAM_HPP
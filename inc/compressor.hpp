@@ -0,0 +1,79 @@
+#ifndef SOCKETS_COMPRESSOR_HPP
+#define SOCKETS_COMPRESSOR_HPP
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Compression algorithm. Value is sent on the wire
+     */
+    enum class CompressionAlgorithm : uint8_t {
+        NONE = 0,
+        LZ4 = 1,
+        ZSTD = 2,
+        ZLIB = 3
+    };
+
+    /**
+     * \brief Interface of message compressor.
+     * Implementation keeps its compression and decompression contexts, so one object should be reused for all messages of a connection.
+     * Object is not thread safe.
+     */
+    class Compressor {
+    public:
+        Compressor() = default;
+        Compressor(const Compressor&) = delete;
+        Compressor(Compressor&&) = delete;
+        Compressor& operator=(const Compressor&) = delete;
+        Compressor& operator=(Compressor&&) = delete;
+        virtual ~Compressor() = default;
+
+        /**
+         * \brief Creates compressor
+         * \param p_algorithm CompressionAlgorithm
+         * \param p_level int32_t compression level. 0 selects default level of the algorithm
+         * \param p_dictionary std::span< const uint8_t > dictionary shared by both sides of connection. Data is copied
+         * \return std::unique_ptr< Compressor >. nullptr if algorithm is CompressionAlgorithm::NONE or library was built without it
+         */
+        [[nodiscard]] static auto create(CompressionAlgorithm p_algorithm, int32_t p_level = 0, std::span< const uint8_t > p_dictionary = {})
+            -> std::unique_ptr< Compressor >;
+        /**
+         * \brief Checks whether library was built with support of the algorithm
+         * \param p_algorithm CompressionAlgorithm
+         * \return bool
+         */
+        [[nodiscard]] static auto supported(CompressionAlgorithm p_algorithm) noexcept -> bool;
+
+        /**
+         * \brief Returns algorithm
+         * \return CompressionAlgorithm
+         */
+        [[nodiscard]] virtual auto algorithm() const noexcept -> CompressionAlgorithm = 0;
+        /**
+         * \brief Returns maximum size of compressed data
+         * \param p_size uint64_t size of uncompressed data
+         * \return uint64_t
+         */
+        [[nodiscard]] virtual auto bound(uint64_t p_size) const noexcept -> uint64_t = 0;
+        /**
+         * \brief Compresses data as a single independent block
+         * \param p_source std::span< const uint8_t >
+         * \param p_destination std::span< uint8_t >
+         * \return uint64_t size of compressed data. 0 on failure or if p_destination is too small
+         */
+        [[nodiscard]] virtual auto compress(std::span< const uint8_t > p_source, std::span< uint8_t > p_destination) -> uint64_t = 0;
+        /**
+         * \brief Decompresses block produced by compress()
+         * \param p_source std::span< const uint8_t >
+         * \param p_destination std::span< uint8_t >. Should be exactly of uncompressed size
+         * \return bool. False if data is corrupted or does not fit
+         */
+        [[nodiscard]] virtual auto decompress(std::span< const uint8_t > p_source, std::span< uint8_t > p_destination) -> bool = 0;
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_COMPRESSOR_HPP
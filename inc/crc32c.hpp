@@ -0,0 +1,29 @@
+#ifndef SOCKETS_CRC32C_HPP
+#define SOCKETS_CRC32C_HPP
+
+#include <cstdint>
+#include <span>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Calculates CRC32C (Castagnoli).
+     * SSE4.2 crc32 instruction is used if CPU supports it, otherwise table based implementation is used.
+     * \param p_data std::span< const uint8_t >
+     * \param p_crc uint32_t CRC of preceding data to continue calculation. Default is 0
+     * \return uint32_t
+     */
+    [[nodiscard]] auto crc32c(std::span< const uint8_t > p_data, uint32_t p_crc = 0) noexcept -> uint32_t;
+
+    /**
+     * \brief Copies data and calculates its CRC32C in a single pass
+     * \param p_source std::span< const uint8_t >
+     * \param p_destination uint8_t*. Should point to at least p_source.size() bytes and should not overlap with p_source
+     * \param p_crc uint32_t CRC of preceding data to continue calculation. Default is 0
+     * \return uint32_t
+     */
+    [[nodiscard]] auto copyCrc32c(std::span< const uint8_t > p_source, uint8_t* p_destination, uint32_t p_crc = 0) noexcept -> uint32_t;
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_CRC32C_HPP
@@ -0,0 +1,95 @@
+#ifndef SOCKETS_ENDPOINT_HPP
+#define SOCKETS_ENDPOINT_HPP
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+struct sockaddr;
+
+namespace tristan::sockets {
+
+    class InetSocket;
+    class IpcSocket;
+
+    /**
+     * \brief Immutable address of a socket with ready to use sockaddr and its length.
+     * Created once and passed to writeTo of SocketType::DATA sockets, so address is not rebuilt for every datagram.
+     * Object does not allocate and may be freely copied
+     */
+    class Endpoint {
+        friend class InetSocket;
+        friend class IpcSocket;
+
+    public:
+        /**
+         * \brief Constructs empty endpoint
+         */
+        Endpoint() noexcept;
+
+        /**
+         * \brief Creates endpoint of InetSocket
+         * \param p_ip uint32_t - IP in network byte order
+         * \param p_port uint16_t - port in network byte order
+         * \return Endpoint
+         */
+        [[nodiscard]] static auto inet(uint32_t p_ip, uint16_t p_port) noexcept -> Endpoint;
+        /**
+         * \brief Creates endpoint of IpcSocket
+         * \param p_name std::string_view
+         * \param p_global_namespace bool. If true, name is in abstract namespace. Default is false
+         * \return Endpoint. Empty if name is empty or does not fit into socket address: path name is limited to 108 bytes, abstract name to 107
+         */
+        [[nodiscard]] static auto ipc(std::string_view p_name, bool p_global_namespace = false) noexcept -> Endpoint;
+
+        /**
+         * \brief Returns pointer to socket address
+         * \return const sockaddr*
+         */
+        [[nodiscard]] auto address() const noexcept -> const sockaddr*;
+        /**
+         * \brief Returns length of socket address
+         * \return uint32_t
+         */
+        [[nodiscard]] auto length() const noexcept -> uint32_t;
+        /**
+         * \brief Returns whether endpoint holds an address
+         * \return bool
+         */
+        [[nodiscard]] auto empty() const noexcept -> bool;
+        /**
+         * \brief Returns IP in network byte order, 0 if endpoint is not an InetSocket endpoint
+         * \return uint32_t
+         */
+        [[nodiscard]] auto ip() const noexcept -> uint32_t;
+        /**
+         * \brief Returns port in network byte order, 0 if endpoint is not an InetSocket endpoint
+         * \return uint16_t
+         */
+        [[nodiscard]] auto port() const noexcept -> uint16_t;
+        /**
+         * \brief Returns name, empty if endpoint is not an IpcSocket endpoint or sender is not bound
+         * \return std::string_view valid while endpoint exists
+         */
+        [[nodiscard]] auto name() const noexcept -> std::string_view;
+        /**
+         * \brief Returns whether name is in abstract namespace
+         * \return bool
+         */
+        [[nodiscard]] auto globalNamespace() const noexcept -> bool;
+
+        /**
+         * \brief Compares socket addresses
+         * \param p_other const Endpoint&
+         * \return bool
+         */
+        [[nodiscard]] auto operator==(const Endpoint& p_other) const noexcept -> bool;
+
+    private:
+        alignas(8) std::array< uint8_t, 128 > m_address;
+        uint32_t m_length;
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_ENDPOINT_HPP
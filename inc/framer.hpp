@@ -0,0 +1,372 @@
+#ifndef SOCKETS_FRAMER_HPP
+#define SOCKETS_FRAMER_HPP
+
+#include "crc32c.hpp"
+#include "socket_error.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <system_error>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Encoding of frame length prefix
+     */
+    enum class FramePrefix : uint8_t {
+        /**
+         * \brief One byte length
+         */
+        FIXED_8,
+        /**
+         * \brief Two bytes length in network byte order
+         */
+        FIXED_16,
+        /**
+         * \brief Four bytes length in network byte order
+         */
+        FIXED_32,
+        /**
+         * \brief Eight bytes length in network byte order
+         */
+        FIXED_64,
+        /**
+         * \brief Unsigned LEB128 length
+         */
+        VARINT
+    };
+
+    /**
+     * \brief Integrity check appended to each frame
+     */
+    enum class FrameIntegrity : uint8_t {
+        /**
+         * \brief No check
+         */
+        NONE,
+        /**
+         * \brief Four bytes CRC32C of payload in network byte order follows payload. Length prefix includes it
+         */
+        CRC32C
+    };
+
+    /**
+     * \brief Class which extracts length prefixed frames from receive buffer
+     * Frames are returned as views into the internal receive buffer and are valid until next call to receiveSpace()
+     */
+    class FrameParser {
+    public:
+        /**
+         * \brief Maximum size of the length prefix in bytes
+         */
+        static constexpr uint8_t max_prefix_size = 10;
+        /**
+         * \brief Size of CRC32C trailer in bytes
+         */
+        static constexpr uint8_t checksum_size = 4;
+
+        /**
+         * \brief Constructor
+         * \param p_prefix FramePrefix. Default is FramePrefix::FIXED_32
+         * \param p_max_frame_size uint64_t maximum size of frame payload. Default is 16 MiB
+         * \param p_buffer_size uint64_t initial size of receive buffer. Default is 64 KiB
+         * \param p_integrity FrameIntegrity. Default is FrameIntegrity::NONE
+         */
+        explicit FrameParser(FramePrefix p_prefix = FramePrefix::FIXED_32,
+                             uint64_t p_max_frame_size = 16 * 1024 * 1024,
+                             uint64_t p_buffer_size = 64 * 1024,
+                             FrameIntegrity p_integrity = FrameIntegrity::NONE);
+
+        /**
+         * \brief Returns free space of the receive buffer.
+         * Data of already extracted frames is discarded, so views returned by previous call to frames() are invalidated.
+         * \return std::span< uint8_t >
+         */
+        [[nodiscard]] auto receiveSpace() -> std::span< uint8_t >;
+        /**
+         * \brief Marks p_size bytes of space returned by receiveSpace() as received
+         * \param p_size uint64_t
+         */
+        void commit(uint64_t p_size);
+        /**
+         * \brief Extracts all complete frames from received data
+         * \return std::span< const std::span< const uint8_t > > views of frames payload
+         */
+        [[nodiscard]] auto frames() -> std::span< const std::span< const uint8_t > >;
+        /**
+         * \brief Returns size of the frame which is received partially including prefix
+         * \return uint64_t. 0 if there is no partially received frame or its size is not known yet
+         */
+        [[nodiscard]] auto pendingFrameSize() const noexcept -> uint64_t;
+        /**
+         * \brief Returns number of received bytes which are not extracted yet
+         * \return uint64_t
+         */
+        [[nodiscard]] auto bufferedSize() const noexcept -> uint64_t;
+        /**
+         * \brief Returns prefix encoding
+         * \return FramePrefix
+         */
+        [[nodiscard]] auto prefix() const noexcept -> FramePrefix;
+        /**
+         * \brief Returns maximum size of frame payload
+         * \return uint64_t
+         */
+        [[nodiscard]] auto maxFrameSize() const noexcept -> uint64_t;
+        /**
+         * \brief Returns integrity check
+         * \return FrameIntegrity
+         */
+        [[nodiscard]] auto integrity() const noexcept -> FrameIntegrity;
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code;
+
+        /**
+         * \brief Encodes length prefix
+         * \param p_prefix FramePrefix
+         * \param p_size uint64_t
+         * \param p_destination uint8_t*. Should point to at least max_prefix_size bytes
+         * \return uint8_t number of bytes written. 0 if size can not be encoded with provided prefix
+         */
+        [[nodiscard]] static auto encodePrefix(FramePrefix p_prefix, uint64_t p_size, uint8_t* p_destination) noexcept -> uint8_t;
+
+    private:
+        std::vector< uint8_t > m_buffer;
+        std::vector< std::span< const uint8_t > > m_frames;
+
+        std::error_code m_error;
+
+        uint64_t m_max_frame_size;
+        uint64_t m_begin;
+        uint64_t m_end;
+        uint64_t m_pending_frame_size;
+
+        FramePrefix m_prefix;
+        FrameIntegrity m_integrity;
+    };
+
+    /**
+     * \brief Length prefixed framing over InetSocket or IpcSocket.
+     * While a frame is received partially, receive low watermark of the socket is set to the number of missing bytes,
+     * so the socket does not wake up until the frame may be completed. Watermark is not used for sockets with SSL
+     * \tparam Socket InetSocket or IpcSocket
+     */
+    template < class Socket > class Framer {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_socket Socket&. Should outlive the framer
+         * \param p_prefix FramePrefix. Default is FramePrefix::FIXED_32
+         * \param p_max_frame_size uint64_t maximum size of frame payload. Default is 16 MiB
+         * \param p_integrity FrameIntegrity. Default is FrameIntegrity::NONE
+         */
+        explicit Framer(Socket& p_socket,
+                        FramePrefix p_prefix = FramePrefix::FIXED_32,
+                        uint64_t p_max_frame_size = 16 * 1024 * 1024,
+                        FrameIntegrity p_integrity = FrameIntegrity::NONE) :
+            m_parser(p_prefix, p_max_frame_size, 64 * 1024, p_integrity),
+            m_socket(p_socket),
+            m_send_offset(0),
+            m_receive_low_watermark(1),
+            m_auto_receive_low_watermark(true) { }
+
+        Framer(const Framer&) = delete;
+        Framer(Framer&&) = delete;
+        Framer& operator=(const Framer&) = delete;
+        Framer& operator=(Framer&&) = delete;
+        ~Framer() = default;
+
+        /**
+         * \brief Receives data with single read call and extracts all complete frames
+         * \return std::span< const std::span< const uint8_t > > views of frames payload valid until next call to readFrames().
+         * On error empty span is returned and error is set respectively
+         */
+        [[nodiscard]] auto readFrames() -> std::span< const std::span< const uint8_t > > {
+            Framer::clearTryAgain();
+            if (m_error) {
+                return {};
+            }
+            auto l_space = m_parser.receiveSpace();
+            m_socket.resetError();
+            auto l_bytes_read = m_socket.readSome(l_space);
+            if (m_socket.error()) {
+                m_error = m_socket.error();
+            }
+            m_parser.commit(l_bytes_read);
+            auto l_frames = m_parser.frames();
+            if (m_parser.error()) {
+                m_error = m_parser.error();
+            }
+            if (m_auto_receive_low_watermark) {
+                Framer::updateReceiveLowWatermark();
+            }
+            return l_frames;
+        }
+
+        /**
+         * \brief Appends frame to the send buffer without sending it
+         * \param p_payload std::span< const uint8_t >
+         */
+        void queueFrame(std::span< const uint8_t > p_payload) { Framer::queueFrame({}, p_payload); }
+
+        /**
+         * \overload
+         * \brief Appends frame which payload consists of header and body to the send buffer without sending it
+         * \param p_header std::span< const uint8_t >
+         * \param p_body std::span< const uint8_t >
+         */
+        void queueFrame(std::span< const uint8_t > p_header, std::span< const uint8_t > p_body) {
+            auto l_payload_size = p_header.size() + p_body.size();
+            if (l_payload_size > m_parser.maxFrameSize()) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::FRAME_TOO_LARGE);
+                return;
+            }
+            bool l_checksum = m_parser.integrity() == FrameIntegrity::CRC32C;
+            uint8_t l_prefix[FrameParser::max_prefix_size];
+            auto l_prefix_size = FrameParser::encodePrefix(m_parser.prefix(), l_payload_size + (l_checksum ? FrameParser::checksum_size : 0), l_prefix);
+            if (l_prefix_size == 0) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::FRAME_TOO_LARGE);
+                return;
+            }
+            if (m_send_offset == m_send_buffer.size()) {
+                m_send_buffer.clear();
+                m_send_offset = 0;
+            }
+            m_send_buffer.insert(m_send_buffer.end(), l_prefix, l_prefix + l_prefix_size);
+            if (not l_checksum) {
+                m_send_buffer.insert(m_send_buffer.end(), p_header.begin(), p_header.end());
+                m_send_buffer.insert(m_send_buffer.end(), p_body.begin(), p_body.end());
+                return;
+            }
+            auto l_offset = m_send_buffer.size();
+            m_send_buffer.resize(l_offset + l_payload_size + FrameParser::checksum_size);
+            auto l_crc = tristan::sockets::copyCrc32c(p_header, m_send_buffer.data() + l_offset);
+            l_crc = tristan::sockets::copyCrc32c(p_body, m_send_buffer.data() + l_offset + p_header.size(), l_crc);
+            auto* l_trailer = m_send_buffer.data() + l_offset + l_payload_size;
+            for (uint8_t i = 0; i < FrameParser::checksum_size; ++i) {
+                l_trailer[FrameParser::checksum_size - 1 - i] = static_cast< uint8_t >(l_crc >> (i * 8));
+            }
+        }
+
+        /**
+         * \brief Sends queued frames
+         * In non blocking mode data which was not accepted by socket is kept and sent on next flush
+         * \return uint64_t number of bytes sent
+         */
+        auto flush() -> uint64_t {
+            Framer::clearTryAgain();
+            uint64_t l_bytes_sent = 0;
+            while (m_send_offset < m_send_buffer.size()) {
+                m_socket.resetError();
+                auto l_sent = m_socket.write(std::span< const uint8_t >(m_send_buffer.data() + m_send_offset, m_send_buffer.size() - m_send_offset));
+                if (l_sent == 0) {
+                    m_error = m_socket.error();
+                    break;
+                }
+                m_send_offset += l_sent;
+                l_bytes_sent += l_sent;
+            }
+            return l_bytes_sent;
+        }
+
+        /**
+         * \brief Queues frame and sends send buffer.
+         * Frame stays queued when socket would block, so it should not be written again after 0 is returned with tristan::sockets::Error::WRITE_TRY_AGAIN
+         * \param p_payload std::span< const uint8_t >
+         * \return uint64_t number of bytes sent
+         */
+        auto writeFrame(std::span< const uint8_t > p_payload) -> uint64_t {
+            Framer::clearTryAgain();
+            auto l_pending_write_size = Framer::pendingWriteSize();
+            Framer::queueFrame(p_payload);
+            if (Framer::pendingWriteSize() == l_pending_write_size) {
+                return 0;
+            }
+            return Framer::flush();
+        }
+
+        /**
+         * \brief Returns number of queued bytes which were not sent yet
+         * \return uint64_t
+         */
+        [[nodiscard]] auto pendingWriteSize() const noexcept -> uint64_t { return m_send_buffer.size() - m_send_offset; }
+
+        /**
+         * \brief Enables or disables setting receive low watermark of the socket from the size of partially received frame.
+         * Enabled by default. When disabled watermark is restored to 1
+         * \param p_enable bool. Default is true
+         */
+        void setAutoReceiveLowWatermark(bool p_enable = true) {
+            m_auto_receive_low_watermark = p_enable;
+            if (not p_enable && m_receive_low_watermark != 1) {
+                m_socket.setReceiveLowWatermark(1);
+                m_receive_low_watermark = 1;
+            }
+        }
+
+        /**
+         * \brief Returns frame parser
+         * \return const FrameParser&
+         */
+        [[nodiscard]] auto parser() const noexcept -> const FrameParser& { return m_parser; }
+
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code { return m_error; }
+
+        /**
+         * \brief Resets error to tristan::socket::Error::SUCCESS.
+         * Errors of the frame parser are not recoverable
+         */
+        void resetError() { m_error = m_parser.error(); }
+
+    private:
+        FrameParser m_parser;
+
+        Socket& m_socket;
+
+        std::vector< uint8_t > m_send_buffer;
+        uint64_t m_send_offset;
+
+        std::error_code m_error;
+
+        uint32_t m_receive_low_watermark;
+        bool m_auto_receive_low_watermark;
+
+        // Error which only reported that socket would block should not stop the next read or write
+        void clearTryAgain() {
+            if (m_error == tristan::sockets::makeError(tristan::sockets::Error::READ_TRY_AGAIN)
+                || m_error == tristan::sockets::makeError(tristan::sockets::Error::WRITE_TRY_AGAIN)) {
+                m_error = {};
+            }
+        }
+
+        void updateReceiveLowWatermark() {
+            if constexpr (requires { m_socket.encrypted(); }) {
+                if (m_socket.encrypted()) {
+                    return;
+                }
+            }
+            uint64_t l_missing = 1;
+            if (m_parser.pendingFrameSize() > m_parser.bufferedSize()) {
+                l_missing = m_parser.pendingFrameSize() - m_parser.bufferedSize();
+            }
+            auto l_low_watermark = static_cast< uint32_t >(std::min< uint64_t >(l_missing, std::numeric_limits< int32_t >::max()));
+            if (l_low_watermark != m_receive_low_watermark) {
+                m_socket.setReceiveLowWatermark(l_low_watermark);
+                m_receive_low_watermark = l_low_watermark;
+            }
+        }
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_FRAMER_HPP
@@ -0,0 +1,466 @@
+#ifndef SOCKETS_HTTP_PARSER_HPP
+#define SOCKETS_HTTP_PARSER_HPP
+
+#include "socket_error.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Type of HTTP message to parse
+     */
+    enum class HttpMessageType : uint8_t {
+        REQUEST,
+        RESPONSE
+    };
+
+    /**
+     * \brief View of HTTP header
+     */
+    struct HttpHeader {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    /**
+     * \brief Incremental allocation free parser of HTTP/1.1 request and response heads.
+     * Parser does not copy data. All returned views point into the buffer passed to parse() or rebind().
+     */
+    class HttpParser {
+    public:
+        /**
+         * \brief Maximum number of headers in message
+         */
+        static constexpr uint16_t max_headers = 64;
+
+        /**
+         * \brief Constructor
+         * \param p_type HttpMessageType. Default is HttpMessageType::REQUEST
+         */
+        explicit HttpParser(HttpMessageType p_type = HttpMessageType::REQUEST);
+
+        /**
+         * \brief Parses message head.
+         * p_data should always start at the beginning of the message and contain all previously passed data.
+         * Scanning is resumed from the position where previous call stopped.
+         * \param p_data std::span< const uint8_t >
+         * \return uint64_t size of the head including terminating empty line or 0 if head is incomplete or error occurred
+         */
+        auto parse(std::span< const uint8_t > p_data) -> uint64_t;
+        /**
+         * \brief Points views to the new location of the same data. Should be called if buffer with parsed head was moved
+         * \param p_data const uint8_t*
+         */
+        void rebind(const uint8_t* p_data) noexcept;
+        /**
+         * \brief Resets parser to initial state
+         */
+        void reset() noexcept;
+
+        /**
+         * \brief Returns true if complete head was parsed
+         * \return bool
+         */
+        [[nodiscard]] auto complete() const noexcept -> bool;
+        /**
+         * \brief Returns request method
+         * \return std::string_view. Empty for responses
+         */
+        [[nodiscard]] auto method() const noexcept -> std::string_view;
+        /**
+         * \brief Returns request target
+         * \return std::string_view. Empty for responses
+         */
+        [[nodiscard]] auto target() const noexcept -> std::string_view;
+        /**
+         * \brief Returns reason phrase
+         * \return std::string_view. Empty for requests
+         */
+        [[nodiscard]] auto reason() const noexcept -> std::string_view;
+        /**
+         * \brief Returns status code
+         * \return uint16_t. 0 for requests
+         */
+        [[nodiscard]] auto statusCode() const noexcept -> uint16_t;
+        /**
+         * \brief Returns minor version of HTTP/1.x
+         * \return uint8_t
+         */
+        [[nodiscard]] auto minorVersion() const noexcept -> uint8_t;
+        /**
+         * \brief Returns number of headers
+         * \return uint16_t
+         */
+        [[nodiscard]] auto headerCount() const noexcept -> uint16_t;
+        /**
+         * \brief Returns header by index
+         * \param p_index uint16_t
+         * \return HttpHeader
+         */
+        [[nodiscard]] auto header(uint16_t p_index) const noexcept -> HttpHeader;
+        /**
+         * \overload
+         * \brief Returns value of the first header with provided name. Comparison is case insensitive
+         * \param p_name std::string_view
+         * \return std::optional< std::string_view >
+         */
+        [[nodiscard]] auto header(std::string_view p_name) const noexcept -> std::optional< std::string_view >;
+        /**
+         * \brief Returns value of Content-Length header
+         * \return std::optional< uint64_t >
+         */
+        [[nodiscard]] auto contentLength() const noexcept -> std::optional< uint64_t >;
+        /**
+         * \brief Returns true if body is sent with chunked transfer coding
+         * \return bool
+         */
+        [[nodiscard]] auto chunked() const noexcept -> bool;
+        /**
+         * \brief Returns true if connection should be kept alive after this message
+         * \return bool
+         */
+        [[nodiscard]] auto keepAlive() const noexcept -> bool;
+        /**
+         * \brief Returns message type
+         * \return HttpMessageType
+         */
+        [[nodiscard]] auto type() const noexcept -> HttpMessageType;
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code;
+
+    private:
+        struct Range {
+            uint32_t offset;
+            uint32_t size;
+        };
+
+        struct HeaderRange {
+            Range name;
+            Range value;
+        };
+
+        auto parseHead(uint64_t p_head_size) -> bool;
+        auto parseStartLine(const uint8_t* p_line, uint64_t p_size) -> bool;
+        [[nodiscard]] auto view(Range p_range) const noexcept -> std::string_view;
+
+        std::array< HeaderRange, max_headers > m_headers;
+
+        std::error_code m_error;
+
+        const uint8_t* m_data;
+
+        uint64_t m_scan_offset;
+        uint64_t m_head_size;
+
+        Range m_method;
+        Range m_target;
+        Range m_reason;
+
+        uint16_t m_status_code;
+        uint16_t m_header_count;
+
+        HttpMessageType m_type;
+        uint8_t m_minor_version;
+    };
+
+    /**
+     * \brief Result of HttpChunkedDecoder::decode()
+     */
+    struct HttpChunkResult {
+        /**
+         * \brief Number of body bytes written to destination
+         */
+        uint64_t decoded;
+        /**
+         * \brief Number of source bytes consumed
+         */
+        uint64_t consumed;
+    };
+
+    /**
+     * \brief Incremental decoder of chunked transfer coding
+     */
+    class HttpChunkedDecoder {
+    public:
+        /**
+         * \brief Constructor
+         */
+        HttpChunkedDecoder();
+
+        /**
+         * \brief Decodes chunked data.
+         * All source bytes are consumed unless the last chunk and trailer were reached, so the decoder may be resumed with new data.
+         * \param p_destination uint8_t*. May be equal to p_source.data() or point before it for in place decoding
+         * \param p_source std::span< const uint8_t >
+         * \return HttpChunkResult
+         */
+        auto decode(uint8_t* p_destination, std::span< const uint8_t > p_source) -> HttpChunkResult;
+        /**
+         * \brief Resets decoder to initial state
+         */
+        void reset() noexcept;
+        /**
+         * \brief Returns true if the last chunk and trailer were decoded
+         * \return bool
+         */
+        [[nodiscard]] auto done() const noexcept -> bool;
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code;
+
+    private:
+        enum class State : uint8_t {
+            SIZE,
+            EXTENSION,
+            SIZE_LF,
+            DATA,
+            DATA_CR,
+            DATA_LF,
+            TRAILER_LINE_START,
+            TRAILER_LINE,
+            TRAILER_END_LF,
+            DONE
+        };
+
+        std::error_code m_error;
+
+        uint64_t m_chunk_remaining;
+
+        State m_state;
+        bool m_size_has_digits;
+    };
+
+    /**
+     * \brief Reads HTTP/1.1 messages from socket using HttpParser and HttpChunkedDecoder over internal receive buffer.
+     * May be used with blocking and non blocking sockets. In non blocking mode read() returns false with READ_TRY_AGAIN error
+     * and should be called again when socket is readable.
+     * \tparam Socket InetSocket or IpcSocket
+     */
+    template < class Socket > class HttpReader {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_socket Socket&. Should outlive the reader
+         * \param p_type HttpMessageType
+         * \param p_max_head_size uint64_t. Default is 64 KiB
+         * \param p_max_body_size uint64_t. Default is 16 MiB
+         */
+        explicit HttpReader(Socket& p_socket, HttpMessageType p_type, uint64_t p_max_head_size = 64 * 1024, uint64_t p_max_body_size = 16 * 1024 * 1024) :
+            m_socket(p_socket),
+            m_parser(p_type),
+            m_buffer(4096),
+            m_max_head_size(p_max_head_size),
+            m_max_body_size(p_max_body_size),
+            m_size(0),
+            m_head_size(0),
+            m_body_size(0),
+            m_raw_offset(0),
+            m_message_end(0),
+            m_state(State::HEAD) { }
+
+        HttpReader(const HttpReader&) = delete;
+        HttpReader(HttpReader&&) = delete;
+        HttpReader& operator=(const HttpReader&) = delete;
+        HttpReader& operator=(HttpReader&&) = delete;
+        ~HttpReader() = default;
+
+        /**
+         * \brief Reads until complete message is available
+         * \return bool. True if message is complete, false if error occurred or, in non blocking mode, more data is needed
+         */
+        auto read() -> bool {
+            m_error = {};
+            while (m_state != State::COMPLETE) {
+                if (HttpReader::process()) {
+                    continue;
+                }
+                if (m_error || not HttpReader::receive()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * \brief Discards current message preserving data of pipelined messages which were already received
+         */
+        void next() {
+            if (m_state != State::COMPLETE) {
+                return;
+            }
+            auto l_left = m_size - m_message_end;
+            if (l_left > 0) {
+                std::memmove(m_buffer.data(), m_buffer.data() + m_message_end, l_left);
+            }
+            m_size = l_left;
+            m_head_size = 0;
+            m_body_size = 0;
+            m_raw_offset = 0;
+            m_message_end = 0;
+            m_parser.reset();
+            m_decoder.reset();
+            m_state = State::HEAD;
+        }
+
+        /**
+         * \brief Returns parser of the current message head
+         * \return const HttpParser&
+         */
+        [[nodiscard]] auto parser() const noexcept -> const HttpParser& { return m_parser; }
+
+        /**
+         * \brief Returns body of current message
+         * \return std::span< const uint8_t >. View valid until next call to read() or next()
+         */
+        [[nodiscard]] auto body() const noexcept -> std::span< const uint8_t > { return {m_buffer.data() + m_head_size, m_body_size}; }
+
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code { return m_error; }
+
+    private:
+        enum class State : uint8_t {
+            HEAD,
+            BODY_LENGTH,
+            BODY_CHUNKED,
+            BODY_UNTIL_EOF,
+            COMPLETE
+        };
+
+        auto process() -> bool {
+            switch (m_state) {
+                case State::HEAD: {
+                    m_head_size = m_parser.parse({m_buffer.data(), m_size});
+                    if (m_parser.error()) {
+                        m_error = m_parser.error();
+                        return false;
+                    }
+                    if (m_head_size == 0) {
+                        if (m_size >= m_max_head_size) {
+                            m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_HEAD_TOO_LARGE);
+                        }
+                        return false;
+                    }
+                    m_raw_offset = m_head_size;
+                    if (m_parser.chunked()) {
+                        m_state = State::BODY_CHUNKED;
+                    } else if (auto l_length = m_parser.contentLength(); l_length.has_value()) {
+                        if (l_length.value() > m_max_body_size) {
+                            m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_BODY_TOO_LARGE);
+                            return false;
+                        }
+                        m_body_size = l_length.value();
+                        m_state = State::BODY_LENGTH;
+                    } else if (m_parser.type() == HttpMessageType::RESPONSE && not m_parser.keepAlive()) {
+                        m_state = State::BODY_UNTIL_EOF;
+                    } else {
+                        m_message_end = m_head_size;
+                        m_state = State::COMPLETE;
+                    }
+                    return true;
+                }
+                case State::BODY_LENGTH: {
+                    if (m_size - m_head_size < m_body_size) {
+                        return false;
+                    }
+                    m_message_end = m_head_size + m_body_size;
+                    m_state = State::COMPLETE;
+                    return true;
+                }
+                case State::BODY_CHUNKED: {
+                    auto l_result = m_decoder.decode(m_buffer.data() + m_head_size + m_body_size, {m_buffer.data() + m_raw_offset, m_size - m_raw_offset});
+                    m_body_size += l_result.decoded;
+                    m_raw_offset += l_result.consumed;
+                    if (m_decoder.error()) {
+                        m_error = m_decoder.error();
+                        return false;
+                    }
+                    if (m_body_size > m_max_body_size) {
+                        m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_BODY_TOO_LARGE);
+                        return false;
+                    }
+                    if (not m_decoder.done()) {
+                        return false;
+                    }
+                    m_message_end = m_raw_offset;
+                    m_state = State::COMPLETE;
+                    return true;
+                }
+                case State::BODY_UNTIL_EOF: {
+                    m_body_size = m_size - m_head_size;
+                    if (m_body_size > m_max_body_size) {
+                        m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_BODY_TOO_LARGE);
+                    }
+                    return false;
+                }
+                case State::COMPLETE: {
+                    return false;
+                }
+            }
+            return false;
+        }
+
+        auto receive() -> bool {
+            uint64_t l_required = m_size + 1;
+            if (m_state == State::BODY_LENGTH) {
+                l_required = m_head_size + m_body_size;
+            }
+            if (l_required > m_buffer.size()) {
+                m_buffer.resize(std::max< uint64_t >(l_required, m_buffer.size() * 2));
+                m_parser.rebind(m_buffer.data());
+            }
+            m_socket.resetError();
+            auto l_bytes_read = m_socket.readSome({m_buffer.data() + m_size, m_buffer.size() - m_size});
+            m_size += l_bytes_read;
+            if (m_socket.error()) {
+                if (m_state == State::BODY_UNTIL_EOF && m_socket.error().value() == static_cast< int >(tristan::sockets::Error::READ_EOF)) {
+                    m_body_size = m_size - m_head_size;
+                    m_message_end = m_size;
+                    m_state = State::COMPLETE;
+                    return true;
+                }
+                m_error = m_socket.error();
+                return false;
+            }
+            return true;
+        }
+
+        Socket& m_socket;
+
+        HttpParser m_parser;
+        HttpChunkedDecoder m_decoder;
+
+        std::vector< uint8_t > m_buffer;
+
+        std::error_code m_error;
+
+        uint64_t m_max_head_size;
+        uint64_t m_max_body_size;
+        uint64_t m_size;
+        uint64_t m_head_size;
+        uint64_t m_body_size;
+        uint64_t m_raw_offset;
+        uint64_t m_message_end;
+
+        State m_state;
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_HTTP_PARSER_HPP
@@ -1,14 +1,78 @@
 #ifndef INET_SOCKET_HPP
 #define INET_SOCKET_HPP
 
+#include "endpoint.hpp"
 #include "socket_common.hpp"
+#include "socket_options.hpp"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <deque>
+#include <functional>
 
 namespace tristan::sockets {
 
     class Ssl;
 
+    /**
+     * \brief Datagram used by batch read and write of SocketType::DATA InetSocket
+     */
+    struct InetDatagram {
+        /**
+         * \brief Storage of the datagram. On write payload is buffer.first(size)
+         */
+        std::span< uint8_t > buffer;
+        /**
+         * \brief Size of the payload. Set on read
+         */
+        uint64_t size = 0;
+        /**
+         * \brief Source ip on read, destination ip on write in network byte order. If ip and port are 0 on write, the socket peer is used
+         */
+        uint32_t ip = 0;
+        /**
+         * \brief Source port on read, destination port on write in network byte order
+         */
+        uint16_t port = 0;
+        /**
+         * \brief Size of each wire datagram the payload consists of, the last one may be shorter. 0 if payload is a single datagram.
+         * On write payload is sent as consecutive datagrams of this size using UDP generic segmentation offload when kernel supports it.
+         * On read it is set when receive offload is enabled and kernel coalesced several datagrams into the buffer
+         */
+        uint16_t segment_size = 0;
+        /**
+         * \brief Set on read if datagram was larger than buffer and its tail was discarded
+         */
+        bool truncated = false;
+
+        /**
+         * \brief Returns payload of the datagram
+         * \return std::span< uint8_t >
+         */
+        [[nodiscard]] auto payload() const noexcept -> std::span< uint8_t > { return buffer.first(std::min< uint64_t >(size, buffer.size())); }
+        /**
+         * \brief Returns number of wire datagrams in payload
+         * \return uint64_t
+         */
+        [[nodiscard]] auto segmentCount() const noexcept -> uint64_t {
+            auto l_size = InetDatagram::payload().size();
+            return segment_size == 0 || l_size == 0 ? 1 : (l_size + segment_size - 1) / segment_size;
+        }
+        /**
+         * \brief Returns wire datagram from payload
+         * \param p_index uint64_t should be less than segmentCount()
+         * \return std::span< uint8_t >
+         */
+        [[nodiscard]] auto segment(uint64_t p_index) const noexcept -> std::span< uint8_t > {
+            if (segment_size == 0) {
+                return InetDatagram::payload();
+            }
+            auto l_offset = p_index * segment_size;
+            return InetDatagram::payload().subspan(l_offset, std::min< uint64_t >(segment_size, InetDatagram::payload().size() - l_offset));
+        }
+    };
+
     /**
      * \brief CLass which is used to connect to remote hosts
      */
@@ -19,6 +83,13 @@ namespace tristan::sockets {
          * \param p_socket_type SocketType. Default is set to SocketType::STREAM
          */
         explicit InetSocket(SocketType p_socket_type = SocketType::STREAM);
+        /**
+         * \overload
+         * \brief Constructor which applies socket options. Options which could not be applied are returned by failedOptions()
+         * \param p_socket_type SocketType
+         * \param p_options const SocketOptions&, e.g. SocketOptions::profile(Profile::LOW_LATENCY)
+         */
+        InetSocket(SocketType p_socket_type, const SocketOptions& p_options);
         /**
          * \brief Deleted copy constructor
          */
@@ -64,6 +135,51 @@ namespace tristan::sockets {
          * \param p_seconds std::chrono::seconds
          */
         void setTimeOut(std::chrono::seconds p_seconds);
+        /**
+         * \brief Applies socket options. Options are also applied to sockets returned by accept().
+         * If some options could not be applied, error is set to SOCKET_SET_OPTION_ERROR and failedOptions() lists them
+         * \param p_options const SocketOptions&
+         */
+        void setOptions(const SocketOptions& p_options);
+        /**
+         * \brief Sets minimum number of bytes which should be queued before read wakes up, so partially received messages do not cause wakeups.
+         * Kernel limits value to half of the receive buffer. Framer sets it automatically from the size of partially received frame
+         * \param p_bytes uint32_t. 1 restores default behaviour
+         */
+        void setReceiveLowWatermark(uint32_t p_bytes);
+        /**
+         * \brief Makes listening socket accept connection only when data arrives from client, so connections which have not sent anything do not wake up server.
+         * May be called before or after listen(), or passed to listen()
+         * \param p_timeout std::chrono::seconds time to wait for data. After it expires connection is accepted anyway. 0 disables deferring
+         */
+        void setDeferAccept(std::chrono::seconds p_timeout);
+        /**
+         * \brief Limits amount of data which was written but not sent by kernel yet.
+         * Socket becomes writable only when not sent data drops below the limit, so data is kept in user space instead of socket buffer and latency of later writes is lower
+         * \param p_bytes uint32_t
+         */
+        void setNotSentLowWatermark(uint32_t p_bytes);
+        /**
+         * \brief Sets size of kernel send buffer. Kernel doubles the value for bookkeeping overhead and stops autotuning the buffer
+         * \param p_bytes uint32_t
+         */
+        void setSendBufferSize(uint32_t p_bytes);
+        /**
+         * \brief Sets size of kernel receive buffer. Kernel doubles the value for bookkeeping overhead and stops autotuning the buffer.
+         * For InetSocket should be set before connect() or listen() to affect window scaling
+         * \param p_bytes uint32_t
+         */
+        void setReceiveBufferSize(uint32_t p_bytes);
+        /**
+         * \brief Returns size of kernel send buffer including bookkeeping overhead
+         * \return uint32_t. 0 on error
+         */
+        [[nodiscard]] auto sendBufferSize() const -> uint32_t;
+        /**
+         * \brief Returns size of kernel receive buffer including bookkeeping overhead
+         * \return uint32_t. 0 on error
+         */
+        [[nodiscard]] auto receiveBufferSize() const -> uint32_t;
         /**
          * \brief Resets error to tristan::socket::Error::SUCCESS
          */
@@ -73,16 +189,50 @@ namespace tristan::sockets {
          * Mandatory function for server side socket
          */
         void bind();
+        /**
+         * \brief Binds client socket to local source address before connect.
+         * With SocketOptions::bind_address_no_port and port 0 kernel chooses source port on connect,
+         * so the same port may be reused towards different destinations
+         * \param p_ip uint32_t - IP in network byte order
+         * \param p_port uint16_t - port in network byte order. Default is 0, any port
+         */
+        void bindSource(uint32_t p_ip, uint16_t p_port = 0);
         /**
          * \brief Sets socket to be in listen mode
          * \param p_connection_count_limit uint32_t
+         * \param p_fast_open_queue_length uint32_t maximum number of pending TCP Fast Open requests, so clients with valid cookie may send data in SYN.
+         * Default is 0 which disables Fast Open. If kernel rejects the option, error is set to tristan::sockets::Error::SOCKET_SET_OPTION_ERROR
+         * and socket still listens with regular handshake
+         * \param p_defer_accept std::chrono::seconds. Connection is accepted only when client sends data or this time expires, see setDeferAccept().
+         * Default is 0 which keeps current setting
          */
-        void listen(uint32_t p_connection_count_limit);
+        void listen(uint32_t p_connection_count_limit, uint32_t p_fast_open_queue_length = 0, std::chrono::seconds p_defer_accept = std::chrono::seconds(0));
         /**
-         * \brief Connects socket to remote ip and port
+         * \brief Connects socket to remote ip and port.
+         * SocketType::DATA socket is connected without SSL, after that datagrams are sent with plain send without route lookup per datagram
+         * and only datagrams from remote ip and port are received
          * \param p_ssl bool
          */
         void connect(bool p_ssl = true);
+        /**
+         * \overload
+         * \brief Connects socket to remote ip and port without SSL, sending initial data in SYN with TCP Fast Open if cookie for the server is known.
+         * Otherwise, or if kernel does not support Fast Open, data is sent after regular handshake
+         * \param p_initial_data std::span< const uint8_t >
+         * \return uint64_t number of bytes of initial data sent. In non blocking mode may be 0 with CONNECT_IN_PROGRESS error, then data should be written once connected
+         */
+        auto connect(std::span< const uint8_t > p_initial_data) -> uint64_t;
+        /**
+         * \brief Enables TCP Fast Open for subsequent connect(bool), so the first written data, including SSL ClientHello, is sent in SYN.
+         * Should be called before connect. If kernel rejects the option, error is set to tristan::sockets::Error::SOCKET_SET_OPTION_ERROR and regular handshake is used
+         * \param p_enable bool. Default is true
+         */
+        void setFastOpen(bool p_enable = true);
+        /**
+         * \brief Returns whether data sent in SYN was acknowledged by peer, or, for accepted socket, whether data was received in SYN
+         * \return bool
+         */
+        [[nodiscard]] auto fastOpenUsed() const -> bool;
         /**
          * \brief Closes the socket
          */
@@ -114,17 +264,29 @@ namespace tristan::sockets {
         auto write(const std::vector< uint8_t >& p_data, uint16_t p_size = 0, uint64_t p_offset = 0) -> uint64_t;
         /**
          * \overload
-         * \brief Writes object casted to std::vector< uint8_t > to socket
-         * \tparam ObjectClassToSend Class which should meat requirement of std::is_standard_layout_v
-         * \param p_object ObjectClassToSend
-         * \return uint64_t indicating number of data sent or 0 if data is empty or error occurred
+         * \brief Writes object representation to socket directly from the object storage
+         * \tparam ObjectClassToSend Class which should meet requirement of TriviallySerializable
+         * \param p_object const ObjectClassToSend&
+         * \return uint64_t indicating number of data sent or 0 if error occurred
          */
         template < class ObjectClassToSend >
-        auto write(ObjectClassToSend p_object) -> uint64_t
-            requires std::is_standard_layout_v< ObjectClassToSend >
+        auto write(const ObjectClassToSend& p_object) -> uint64_t
+            requires TriviallySerializable< ObjectClassToSend >
         {
-            std::vector< uint8_t > l_temp_data(reinterpret_cast< uint8_t* >(&p_object), reinterpret_cast< uint8_t* >(&p_object) + sizeof(p_object));
-            return InetSocket::write(l_temp_data);
+            return InetSocket::writeBytes(reinterpret_cast< const uint8_t* >(&p_object), sizeof(p_object));
+        }
+        /**
+         * \overload
+         * \brief Writes contiguous array of objects to socket directly from the objects storage
+         * \tparam ObjectClassToSend Class which should meet requirement of TriviallySerializable
+         * \param p_objects std::span< ObjectClassToSend, Extent >
+         * \return uint64_t indicating number of bytes sent or 0 if span is empty or error occurred
+         */
+        template < class ObjectClassToSend, std::size_t Extent >
+        auto write(std::span< ObjectClassToSend, Extent > p_objects) -> uint64_t
+            requires TriviallySerializable< std::remove_const_t< ObjectClassToSend > >
+        {
+            return InetSocket::writeBytes(reinterpret_cast< const uint8_t* >(p_objects.data()), p_objects.size_bytes());
         }
         /**
          * \brief Reads one byte from socket
@@ -139,6 +301,41 @@ namespace tristan::sockets {
          * \return std::vector< uint8_t >
          */
         [[nodiscard]] auto read(uint16_t p_size) -> std::vector< uint8_t >;
+        /**
+         * \overload
+         * \brief Reads object representation from socket directly into the object storage
+         * \tparam ObjectClassToReceive Class which should meet requirement of TriviallySerializable
+         * \return ObjectClassToReceive. If object was not read completely value initialised object is returned and error is set respectively
+         */
+        template < class ObjectClassToReceive >
+        [[nodiscard]] auto read() -> ObjectClassToReceive
+            requires TriviallySerializable< ObjectClassToReceive > && std::is_default_constructible_v< ObjectClassToReceive >
+        {
+            ObjectClassToReceive l_object{};
+            if (InetSocket::readBytes(reinterpret_cast< uint8_t* >(&l_object), sizeof(l_object)) != sizeof(l_object)) {
+                return ObjectClassToReceive{};
+            }
+            return l_object;
+        }
+        /**
+         * \brief Reads contiguous array of objects from socket directly into provided storage
+         * \tparam ObjectClassToReceive Class which should meet requirement of TriviallySerializable
+         * \param p_objects std::span< ObjectClassToReceive, Extent >
+         * \return uint64_t indicating number of bytes read.
+         * In non blocking mode value may be less than p_objects.size_bytes() and the error is set to READ_TRY_AGAIN
+         */
+        template < class ObjectClassToReceive, std::size_t Extent >
+        [[nodiscard]] auto readInto(std::span< ObjectClassToReceive, Extent > p_objects) -> uint64_t
+            requires TriviallySerializable< ObjectClassToReceive >
+        {
+            return InetSocket::readBytes(reinterpret_cast< uint8_t* >(p_objects.data()), p_objects.size_bytes());
+        }
+        /**
+         * \brief Reads data which is available in socket using single receive call
+         * \param p_buffer std::span< uint8_t >
+         * \return uint64_t number of bytes read. On error or EOF 0 is returned and error is set respectively
+         */
+        [[nodiscard]] auto readSome(std::span< uint8_t > p_buffer) -> uint64_t;
         /**
          * \brief reads from socket until the delimiter is reached
          * \param p_delimiter uint8_t
@@ -152,6 +349,148 @@ namespace tristan::sockets {
          * \return std::vector< uint8_t >
          */
         [[nodiscard]] auto readUntil(const std::vector< uint8_t >& p_delimiter) -> std::vector< uint8_t >;
+        /**
+         * \overload
+         * \brief Reads provided size of data from socket into the vector allocated from memory resource
+         * \param p_size uint16_t
+         * \param p_resource std::pmr::memory_resource*. If nullptr the resource of the socket is used
+         * \return std::pmr::vector< uint8_t > containing only received bytes
+         */
+        [[nodiscard]] auto read(uint16_t p_size, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t >;
+        /**
+         * \overload
+         * \brief reads from socket until the delimiter is reached into the vector allocated from memory resource
+         * \param p_delimiter uint8_t
+         * \param p_resource std::pmr::memory_resource*. If nullptr the resource of the socket is used
+         * \return std::pmr::vector< uint8_t >
+         */
+        [[nodiscard]] auto readUntil(uint8_t p_delimiter, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t >;
+        /**
+         * \overload
+         * \brief reads from socket until the delimiter is reached into the vector allocated from memory resource
+         * \param p_delimiter std::span< const uint8_t >
+         * \param p_resource std::pmr::memory_resource*. If nullptr the resource of the socket is used
+         * \return std::pmr::vector< uint8_t >
+         */
+        [[nodiscard]] auto readUntil(std::span< const uint8_t > p_delimiter, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t >;
+        /**
+         * \brief Sends part of file without copying it through user space using sendfile.
+         * Not available on SSL connection. Peer which closed connection is reported with WRITE_PIPE error and does not raise SIGPIPE
+         * \param p_file_descriptor int32_t file opened for reading
+         * \param p_offset uint64_t offset in file. File position is not changed
+         * \param p_size uint64_t
+         * \return uint64_t number of bytes sent. May be less than p_size on error, on end of file,
+         * or in non blocking mode, in which case the error is set to WRITE_TRY_AGAIN and transfer may be resumed from p_offset + returned value
+         */
+        auto sendFile(int32_t p_file_descriptor, uint64_t p_offset, uint64_t p_size) -> uint64_t;
+        /**
+         * \brief Receives data into file at its current position without copying it through user space using splice through pipe.
+         * Pipe is created on first call and kept until the socket is closed. Not available on SSL connection
+         * \param p_file_descriptor int32_t file opened for writing
+         * \param p_size uint64_t
+         * \return uint64_t number of bytes written to file. May be less than p_size on error, on EOF,
+         * or in non blocking mode, in which case the error is set to READ_TRY_AGAIN and transfer may be resumed by the next call
+         */
+        auto receiveToFile(int32_t p_file_descriptor, uint64_t p_size) -> uint64_t;
+        /**
+         * \brief Sends datagram to endpoint of SocketType::DATA socket
+         * \param p_data std::span< const uint8_t >
+         * \param p_endpoint const Endpoint&
+         * \return uint64_t number of bytes sent
+         */
+        auto writeTo(std::span< const uint8_t > p_data, const Endpoint& p_endpoint) -> uint64_t;
+        /**
+         * \brief Receives datagram of SocketType::DATA socket together with its source
+         * \param p_buffer std::span< uint8_t >. If datagram is larger than buffer, its tail is discarded
+         * \return std::pair< uint64_t, Endpoint > number of bytes received and source endpoint
+         */
+        [[nodiscard]] auto readFrom(std::span< uint8_t > p_buffer) -> std::pair< uint64_t, Endpoint >;
+        /**
+         * \brief Receives up to p_datagrams.size() datagrams with as few system calls as possible.
+         * Blocks until the first datagram is available if socket is blocking, the rest are only taken if already queued
+         * \param p_datagrams std::span< InetDatagram >. Size, source address and truncation flag of each received datagram are set
+         * \return uint64_t number of received datagrams
+         */
+        [[nodiscard]] auto readBatch(std::span< InetDatagram > p_datagrams) -> uint64_t;
+        /**
+         * \brief Sends datagrams with as few system calls as possible
+         * \param p_datagrams std::span< const InetDatagram >
+         * \return uint64_t number of sent datagrams. In non blocking mode value may be less than p_datagrams.size() and the error is set to WRITE_TRY_AGAIN.
+         * Segments of the next datagram which were already sent are remembered, so the call should be repeated with p_datagrams.subspan(returned value)
+         */
+        auto writeBatch(std::span< const InetDatagram > p_datagrams) -> uint64_t;
+        /**
+         * \brief Enables or disables UDP generic receive offload, so kernel may coalesce several datagrams of the same flow into one read.
+         * If kernel does not support it, offload stays disabled and datagrams are received one by one.
+         * Buffers passed to readBatch() should be large enough for coalesced data, up to 64 KiB
+         * \param p_enable bool. Default is true
+         */
+        void setReceiveOffload(bool p_enable = true);
+        /**
+         * \brief Returns whether UDP generic receive offload is enabled
+         * \return bool
+         */
+        [[nodiscard]] auto receiveOffload() const noexcept -> bool;
+        /**
+         * \brief Returns whether kernel supports UDP generic segmentation offload for the socket.
+         * Datagrams with segment_size are sent one wire datagram per message when it does not
+         * \return bool
+         */
+        [[nodiscard]] auto segmentationOffload() const noexcept -> bool;
+        /**
+         * \brief Returns number of bytes in send queue which were not sent by kernel yet
+         * \return uint64_t
+         */
+        [[nodiscard]] auto notSentSize() const -> uint64_t;
+        /**
+         * \brief Enables or disables zero copy sending with MSG_ZEROCOPY for writeZeroCopy().
+         * If kernel does not support it, zero copy stays disabled and writeZeroCopy() copies data as write does
+         * \param p_enable bool. Default is true
+         * \param p_threshold uint64_t writes smaller than this are sent with regular send, since page pinning and completion handling cost more than copying. Default is 16 KiB
+         */
+        void setZeroCopy(bool p_enable = true, uint64_t p_threshold = 16 * 1024);
+        /**
+         * \brief Returns whether zero copy sending is enabled
+         * \return bool
+         */
+        [[nodiscard]] auto zeroCopy() const noexcept -> bool;
+        /**
+         * \brief Sends data without copying it into kernel. Data should not be modified or released until p_on_complete is called.
+         * Callback is called from pollZeroCopy() when kernel notifies that it does not use the data any more, or immediately if data was sent with regular send.
+         * close() waits up to a second for pending writes, then disconnects so kernel drops unsent data and releases the rest.
+         * Callbacks of writes which kernel still did not release after that are destroyed without being called
+         * \param p_data std::span< const uint8_t >
+         * \param p_on_complete std::function< void() >. May be empty
+         * \return uint64_t number of bytes sent
+         */
+        auto writeZeroCopy(std::span< const uint8_t > p_data, std::function< void() > p_on_complete) -> uint64_t;
+        /**
+         * \brief Reads zero copy completion notifications from socket error queue and calls callbacks of completed writes
+         * \param p_timeout std::chrono::milliseconds time to wait for notification if there are pending writes. Default is 0
+         * \return uint64_t number of completed writes
+         */
+        auto pollZeroCopy(std::chrono::milliseconds p_timeout = std::chrono::milliseconds(0)) -> uint64_t;
+        /**
+         * \brief Returns number of zero copy writes which data is still used by kernel
+         * \return uint64_t
+         */
+        [[nodiscard]] auto pendingZeroCopyWrites() const noexcept -> uint64_t;
+        /**
+         * \brief Returns number of zero copy sends for which kernel reported that it copied data anyway, e.g. on loopback
+         * \return uint64_t
+         */
+        [[nodiscard]] auto zeroCopyCopiedCount() const noexcept -> uint64_t;
+        /**
+         * \brief Sets memory resource which is used by std::pmr read functions when no resource is provided.
+         * Sockets returned by accept() inherit the resource
+         * \param p_resource std::pmr::memory_resource*. Should outlive the socket. If nullptr std::pmr::get_default_resource() is used
+         */
+        void setMemoryResource(std::pmr::memory_resource* p_resource) noexcept;
+        /**
+         * \brief Returns memory resource of the socket
+         * \return std::pmr::memory_resource*
+         */
+        [[nodiscard]] auto memoryResource() const noexcept -> std::pmr::memory_resource*;
 
         /**
          * \brief Returns ip
@@ -163,6 +502,21 @@ namespace tristan::sockets {
          * \return uint16_t
          */
         [[nodiscard]] auto port() const noexcept -> uint16_t;
+        /**
+         * \brief Returns endpoint built from ip and port
+         * \return const Endpoint&
+         */
+        [[nodiscard]] auto remoteEndpoint() const noexcept -> const Endpoint&;
+        /**
+         * \brief Returns options applied by last call to setOptions()
+         * \return const SocketOptions&
+         */
+        [[nodiscard]] auto options() const noexcept -> const SocketOptions&;
+        /**
+         * \brief Returns options which could not be applied by last call to setOptions()
+         * \return const std::vector< SocketOption >&
+         */
+        [[nodiscard]] auto failedOptions() const noexcept -> const std::vector< SocketOption >&;
         /**
          * \brief Returns error
          * \return std::error_code
@@ -178,12 +532,46 @@ namespace tristan::sockets {
          * \return bool
          */
         [[nodiscard]] auto connected() const noexcept -> bool;
+        /**
+         * \brief Returns socket file descriptor, e.g. to register it in event loop. Ownership stays with the socket
+         * \return int32_t. -1 if socket is not initialised
+         */
+        [[nodiscard]] auto nativeHandle() const noexcept -> int32_t;
+        /**
+         * \brief Returns CPU which processed the last packet received by the socket, so connection may be handled on the same core
+         * \return int32_t. -1 on error or if it is not known yet
+         */
+        [[nodiscard]] auto incomingCpu() const -> int32_t;
+        /**
+         * \brief Returns local address and port the socket is bound to
+         * \return Endpoint. Empty on error
+         */
+        [[nodiscard]] auto localEndpoint() const -> Endpoint;
+        /**
+         * \brief Returns whether connection is encrypted with SSL, so data can not be transferred by kernel as is
+         * \return bool
+         */
+        [[nodiscard]] auto encrypted() const noexcept -> bool;
 
     protected:
     private:
+        struct ZeroCopyWrite {
+            uint32_t first_id;
+            uint32_t last_id;
+            std::function< void() > on_complete;
+        };
 
         explicit InetSocket(bool);
 
+        auto writeBytes(const uint8_t* p_data, uint64_t p_size) -> uint64_t;
+        auto readBytes(uint8_t* p_data, uint64_t p_size) -> uint64_t;
+        auto readByte(uint8_t& p_byte) -> uint64_t;
+        auto receive(std::span< uint8_t > p_buffer) -> uint64_t;
+        auto createPipe() -> bool;
+        void closePipe();
+        void rearmQuickAck(uint64_t p_bytes_read);
+        void drainZeroCopy();
+
         std::string m_host_name;
 
         int32_t m_socket;
@@ -191,9 +579,30 @@ namespace tristan::sockets {
 
         std::error_code m_error;
 
+        std::pmr::memory_resource* m_memory_resource;
+
         uint16_t m_port;
 
+        Endpoint m_remote_endpoint;
+
+        SocketOptions m_options;
+        std::vector< SocketOption > m_failed_options;
+
         std::unique_ptr<Ssl> m_ssl;
+
+        std::deque< ZeroCopyWrite > m_zero_copy_writes;
+        std::vector< std::pair< uint32_t, uint32_t > > m_zero_copy_completed_ranges;
+
+        uint64_t m_zero_copy_threshold;
+        uint64_t m_zero_copy_copied;
+        uint32_t m_zero_copy_next_id;
+        uint32_t m_zero_copy_completed_id;
+
+        std::array< int32_t, 2 > m_pipe;
+        uint64_t m_pipe_capacity;
+
+        uint64_t m_batch_offset;
+
         SocketType m_type;
 
 
@@ -202,6 +611,10 @@ namespace tristan::sockets {
         bool m_listening;
         bool m_not_ssl_connected;
         bool m_connected;
+        bool m_segmentation_offload;
+        bool m_receive_offload;
+        bool m_zero_copy;
+        bool m_quick_ack;
     };
 
 }  // namespace tristan::sockets
@@ -1,9 +1,38 @@
 #ifndef IPC_SOCKET_HPP
 #define IPC_SOCKET_HPP
 
+#include "endpoint.hpp"
 #include "socket_common.hpp"
 
 namespace tristan::sockets {
+
+    /**
+     * \brief Datagram used by batch read and write of SocketType::DATA IpcSocket
+     */
+    struct IpcDatagram {
+        /**
+         * \brief Storage of the datagram. On write payload is buffer.first(size)
+         */
+        std::span< uint8_t > buffer;
+        /**
+         * \brief Size of the payload. Set on read
+         */
+        uint64_t size = 0;
+        /**
+         * \brief Source name on read, destination name on write. If empty on write, the socket peer is used.
+         * Empty on read if the sender is not bound
+         */
+        std::string name;
+        /**
+         * \brief Whether name is in abstract namespace
+         */
+        bool global_namespace = false;
+        /**
+         * \brief Set on read if datagram was larger than buffer and its tail was discarded
+         */
+        bool truncated = false;
+    };
+
     /**
      * \brief Class which is used to connect to local hosts
      */
@@ -52,6 +81,34 @@ namespace tristan::sockets {
          * \param p_non_blocking bool. Default is true
          */
         void setNonBlocking(bool p_non_blocking = true);
+        /**
+         * \brief Sets minimum number of bytes which should be queued before read returns, so partially received messages do not cause extra reads.
+         * Framer sets it automatically from the size of partially received frame
+         * \param p_bytes uint32_t. 1 restores default behaviour
+         */
+        void setReceiveLowWatermark(uint32_t p_bytes);
+        /**
+         * \brief Sets size of kernel send buffer. Kernel doubles the value for bookkeeping overhead.
+         * Data written to local socket stays charged to this buffer until the peer reads it, so it limits how much may be queued to the peer
+         * \param p_bytes uint32_t
+         */
+        void setSendBufferSize(uint32_t p_bytes);
+        /**
+         * \brief Sets size of kernel receive buffer. Kernel doubles the value for bookkeeping overhead.
+         * Amount of data queued on local socket is limited by send buffer of the writing side, so the value is reported by receiveBufferSize() but does not limit receiving
+         * \param p_bytes uint32_t
+         */
+        void setReceiveBufferSize(uint32_t p_bytes);
+        /**
+         * \brief Returns size of kernel send buffer including bookkeeping overhead
+         * \return uint32_t. 0 on error
+         */
+        [[nodiscard]] auto sendBufferSize() const -> uint32_t;
+        /**
+         * \brief Returns size of kernel receive buffer including bookkeeping overhead
+         * \return uint32_t. 0 on error
+         */
+        [[nodiscard]] auto receiveBufferSize() const -> uint32_t;
         /**
          * \brief Resets error to tristan::socket::Error::SUCCESS
          */
@@ -67,8 +124,8 @@ namespace tristan::sockets {
          */
         void listen(uint32_t p_connection_count_limit);
         /**
-         * \brief Connects socket to peer
-         * \param p_ssl bool
+         * \brief Connects socket to peer.
+         * SocketType::DATA socket sends datagrams with plain send after that and only receives datagrams from the peer
          */
         void connect();
         /**
@@ -102,17 +159,29 @@ namespace tristan::sockets {
         auto write(const std::vector< uint8_t >& p_data, uint16_t p_size = 0, uint64_t p_offset = 0) -> uint64_t;
         /**
          * \overload
-         * \brief Writes object casted to std::vector< uint8_t > to socket
-         * \tparam ObjectClassToSend Class which should meat requirement of std::is_standard_layout_v
-         * \param p_object ObjectClassToSend
-         * \return uint64_t indicating number of data sent or 0 if data is empty or error occurred
+         * \brief Writes object representation to socket directly from the object storage
+         * \tparam ObjectClassToSend Class which should meet requirement of TriviallySerializable
+         * \param p_object const ObjectClassToSend&
+         * \return uint64_t indicating number of data sent or 0 if error occurred
          */
         template < class ObjectClassToSend >
-        auto write(ObjectClassToSend p_object) -> uint64_t
-            requires std::is_standard_layout_v< ObjectClassToSend >
+        auto write(const ObjectClassToSend& p_object) -> uint64_t
+            requires TriviallySerializable< ObjectClassToSend >
+        {
+            return IpcSocket::writeBytes(reinterpret_cast< const uint8_t* >(&p_object), sizeof(p_object));
+        }
+        /**
+         * \overload
+         * \brief Writes contiguous array of objects to socket directly from the objects storage
+         * \tparam ObjectClassToSend Class which should meet requirement of TriviallySerializable
+         * \param p_objects std::span< ObjectClassToSend, Extent >
+         * \return uint64_t indicating number of bytes sent or 0 if span is empty or error occurred
+         */
+        template < class ObjectClassToSend, std::size_t Extent >
+        auto write(std::span< ObjectClassToSend, Extent > p_objects) -> uint64_t
+            requires TriviallySerializable< std::remove_const_t< ObjectClassToSend > >
         {
-            std::vector< uint8_t > l_temp_data(reinterpret_cast< uint8_t* >(&p_object), reinterpret_cast< uint8_t* >(&p_object) + sizeof(p_object));
-            return IpcSocket::write(l_temp_data);
+            return IpcSocket::writeBytes(reinterpret_cast< const uint8_t* >(p_objects.data()), p_objects.size_bytes());
         }
         /**
          * \brief Reads one byte from socket
@@ -127,6 +196,41 @@ namespace tristan::sockets {
          * \return std::vector< uint8_t >
          */
         [[nodiscard]] auto read(uint16_t p_size) -> std::vector< uint8_t >;
+        /**
+         * \overload
+         * \brief Reads object representation from socket directly into the object storage
+         * \tparam ObjectClassToReceive Class which should meet requirement of TriviallySerializable
+         * \return ObjectClassToReceive. If object was not read completely value initialised object is returned and error is set respectively
+         */
+        template < class ObjectClassToReceive >
+        [[nodiscard]] auto read() -> ObjectClassToReceive
+            requires TriviallySerializable< ObjectClassToReceive > && std::is_default_constructible_v< ObjectClassToReceive >
+        {
+            ObjectClassToReceive l_object{};
+            if (IpcSocket::readBytes(reinterpret_cast< uint8_t* >(&l_object), sizeof(l_object)) != sizeof(l_object)) {
+                return ObjectClassToReceive{};
+            }
+            return l_object;
+        }
+        /**
+         * \brief Reads contiguous array of objects from socket directly into provided storage
+         * \tparam ObjectClassToReceive Class which should meet requirement of TriviallySerializable
+         * \param p_objects std::span< ObjectClassToReceive, Extent >
+         * \return uint64_t indicating number of bytes read.
+         * In non blocking mode value may be less than p_objects.size_bytes() and the error is set to READ_TRY_AGAIN
+         */
+        template < class ObjectClassToReceive, std::size_t Extent >
+        [[nodiscard]] auto readInto(std::span< ObjectClassToReceive, Extent > p_objects) -> uint64_t
+            requires TriviallySerializable< ObjectClassToReceive >
+        {
+            return IpcSocket::readBytes(reinterpret_cast< uint8_t* >(p_objects.data()), p_objects.size_bytes());
+        }
+        /**
+         * \brief Reads data which is available in socket using single receive call
+         * \param p_buffer std::span< uint8_t >
+         * \return uint64_t number of bytes read. On error or EOF 0 is returned and error is set respectively
+         */
+        [[nodiscard]] auto readSome(std::span< uint8_t > p_buffer) -> uint64_t;
         /**
          * \brief reads from socket until the delimiter is reached
          * \param p_delimiter uint8_t
@@ -140,6 +244,67 @@ namespace tristan::sockets {
          * \return std::vector< uint8_t >
          */
         [[nodiscard]] auto readUntil(const std::vector< uint8_t >& p_delimiter) -> std::vector< uint8_t >;
+        /**
+         * \overload
+         * \brief Reads provided size of data from socket into the vector allocated from memory resource
+         * \param p_size uint16_t
+         * \param p_resource std::pmr::memory_resource*. If nullptr the resource of the socket is used
+         * \return std::pmr::vector< uint8_t > containing only received bytes
+         */
+        [[nodiscard]] auto read(uint16_t p_size, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t >;
+        /**
+         * \overload
+         * \brief reads from socket until the delimiter is reached into the vector allocated from memory resource
+         * \param p_delimiter uint8_t
+         * \param p_resource std::pmr::memory_resource*. If nullptr the resource of the socket is used
+         * \return std::pmr::vector< uint8_t >
+         */
+        [[nodiscard]] auto readUntil(uint8_t p_delimiter, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t >;
+        /**
+         * \overload
+         * \brief reads from socket until the delimiter is reached into the vector allocated from memory resource
+         * \param p_delimiter std::span< const uint8_t >
+         * \param p_resource std::pmr::memory_resource*. If nullptr the resource of the socket is used
+         * \return std::pmr::vector< uint8_t >
+         */
+        [[nodiscard]] auto readUntil(std::span< const uint8_t > p_delimiter, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t >;
+        /**
+         * \brief Sends datagram to endpoint of SocketType::DATA socket
+         * \param p_data std::span< const uint8_t >
+         * \param p_endpoint const Endpoint&
+         * \return uint64_t number of bytes sent
+         */
+        auto writeTo(std::span< const uint8_t > p_data, const Endpoint& p_endpoint) -> uint64_t;
+        /**
+         * \brief Receives datagram of SocketType::DATA socket together with its source
+         * \param p_buffer std::span< uint8_t >. If datagram is larger than buffer, its tail is discarded
+         * \return std::pair< uint64_t, Endpoint > number of bytes received and source endpoint. Endpoint name is empty if sender is not bound
+         */
+        [[nodiscard]] auto readFrom(std::span< uint8_t > p_buffer) -> std::pair< uint64_t, Endpoint >;
+        /**
+         * \brief Receives up to p_datagrams.size() datagrams with as few system calls as possible.
+         * Blocks until the first datagram is available if socket is blocking, the rest are only taken if already queued
+         * \param p_datagrams std::span< IpcDatagram >. Size, source name and truncation flag of each received datagram are set
+         * \return uint64_t number of received datagrams
+         */
+        [[nodiscard]] auto readBatch(std::span< IpcDatagram > p_datagrams) -> uint64_t;
+        /**
+         * \brief Sends datagrams with as few system calls as possible
+         * \param p_datagrams std::span< const IpcDatagram >
+         * \return uint64_t number of sent datagrams. In non blocking mode value may be less than p_datagrams.size() and the error is set to WRITE_TRY_AGAIN
+         */
+        auto writeBatch(std::span< const IpcDatagram > p_datagrams) -> uint64_t;
+        /**
+         * \brief Sets memory resource which is used by std::pmr read functions when no resource is provided.
+         * Sockets returned by accept() inherit the resource
+         * \param p_resource std::pmr::memory_resource*. Should outlive the socket. If nullptr std::pmr::get_default_resource() is used
+         */
+        void setMemoryResource(std::pmr::memory_resource* p_resource) noexcept;
+        /**
+         * \brief Returns memory resource of the socket
+         * \return std::pmr::memory_resource*
+         */
+        [[nodiscard]] auto memoryResource() const noexcept -> std::pmr::memory_resource*;
         /**
          * \brief Returns name of the socket
          * \return const std::string&
@@ -150,6 +315,11 @@ namespace tristan::sockets {
          * \return const std::string&
          */
         [[nodiscard]] auto peerName() const noexcept -> const std::string&;
+        /**
+         * \brief Returns endpoint built from peer name
+         * \return const Endpoint&
+         */
+        [[nodiscard]] auto peerEndpoint() const noexcept -> const Endpoint&;
         /**
          * \brief Returns error
          * \return std::error_code
@@ -165,16 +335,28 @@ namespace tristan::sockets {
          * \return bool
          */
         [[nodiscard]] auto connected() const noexcept -> bool;
+        /**
+         * \brief Returns socket file descriptor, e.g. to register it in event loop. Ownership stays with the socket
+         * \return int32_t. -1 if socket is not initialised
+         */
+        [[nodiscard]] auto nativeHandle() const noexcept -> int32_t;
 
     protected:
     private:
         explicit IpcSocket(bool);
 
+        auto writeBytes(const uint8_t* p_data, uint64_t p_size) -> uint64_t;
+        auto readBytes(uint8_t* p_data, uint64_t p_size) -> uint64_t;
+
         std::string m_name;
         std::string m_peer_name;
 
+        Endpoint m_peer_endpoint;
+
         std::error_code m_error;
 
+        std::pmr::memory_resource* m_memory_resource;
+
         int32_t m_socket;
 
         SocketType m_type;
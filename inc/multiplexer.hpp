@@ -0,0 +1,607 @@
+#ifndef SOCKETS_MULTIPLEXER_HPP
+#define SOCKETS_MULTIPLEXER_HPP
+
+#include "framer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <span>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Side of multiplexed connection. Client opens odd numbered streams, server opens even numbered ones
+     */
+    enum class MultiplexerRole : uint8_t {
+        CLIENT,
+        SERVER
+    };
+
+    /**
+     * \brief Multiplexes numbered logical streams over a single InetSocket or IpcSocket connection.
+     * Each stream has its own flow control window, data of streams is interleaved in round robin order in chunks of limited size.
+     * Every frame payload starts with one byte type and four bytes stream id in network byte order.
+     * Optional heartbeat sends PING frame with stream id 0 on idle connection from poll() and fails the connection with tristan::sockets::Error::PEER_DEAD
+     * when nothing is received in time, so event loop calling poll() detects dead peer without waiting for kernel timeouts.
+     * \tparam Socket InetSocket or IpcSocket
+     */
+    template < class Socket > class Multiplexer {
+        enum class FrameType : uint8_t {
+            DATA,
+            WINDOW_UPDATE,
+            FIN,
+            RESET,
+            PING,
+            PONG
+        };
+
+        static constexpr uint8_t header_size = 5;
+        static constexpr uint64_t flush_threshold = 64 * 1024;
+
+    public:
+        /**
+         * \brief Logical stream. Should not outlive the multiplexer
+         */
+        class Stream {
+        public:
+            Stream(const Stream&) = delete;
+            Stream(Stream&&) = delete;
+            Stream& operator=(const Stream&) = delete;
+            Stream& operator=(Stream&&) = delete;
+            ~Stream() = default;
+
+            /**
+             * \brief Queues data for sending and sends as much as flow control allows.
+             * Blocking socket waits until at least one byte is accepted, non blocking returns 0 with tristan::sockets::Error::WRITE_TRY_AGAIN
+             * \param p_data std::span< const uint8_t >
+             * \return uint64_t number of accepted bytes
+             */
+            auto write(std::span< const uint8_t > p_data) -> uint64_t {
+                m_error = {};
+                if (m_fin_queued || m_reset) {
+                    m_error = tristan::sockets::makeError(tristan::sockets::Error::MUX_STREAM_CLOSED);
+                    return 0;
+                }
+                while (true) {
+                    auto l_buffered = m_send_buffer.size() - m_send_offset;
+                    auto l_accepted = std::min< uint64_t >(p_data.size(), l_buffered < m_multiplexer.m_window ? m_multiplexer.m_window - l_buffered : 0);
+                    if (l_accepted > 0) {
+                        if (m_send_offset == m_send_buffer.size()) {
+                            m_send_buffer.clear();
+                            m_send_offset = 0;
+                        }
+                        m_send_buffer.insert(m_send_buffer.end(), p_data.begin(), p_data.begin() + static_cast< std::ptrdiff_t >(l_accepted));
+                        m_multiplexer.schedule(*this);
+                        m_multiplexer.pump();
+                        return l_accepted;
+                    }
+                    if (m_multiplexer.m_error || m_reset) {
+                        m_error = m_reset ? tristan::sockets::makeError(tristan::sockets::Error::MUX_STREAM_RESET) : m_multiplexer.m_error;
+                        return 0;
+                    }
+                    if (m_multiplexer.m_socket.nonBlocking()) {
+                        m_multiplexer.poll();
+                        m_error = tristan::sockets::makeError(tristan::sockets::Error::WRITE_TRY_AGAIN);
+                        return 0;
+                    }
+                    m_multiplexer.poll();
+                }
+            }
+
+            /**
+             * \brief Reads received data.
+             * Blocking socket waits until data is available, non blocking returns 0 with tristan::sockets::Error::READ_TRY_AGAIN.
+             * When peer closed the stream and all data was read returns 0 with tristan::sockets::Error::READ_EOF
+             * \param p_buffer std::span< uint8_t >
+             * \return uint64_t number of bytes read
+             */
+            auto read(std::span< uint8_t > p_buffer) -> uint64_t {
+                m_error = {};
+                while (true) {
+                    auto l_available = Stream::available();
+                    if (l_available > 0 && not p_buffer.empty()) {
+                        auto l_size = std::min< uint64_t >(l_available, p_buffer.size());
+                        std::memcpy(p_buffer.data(), m_receive_buffer.data() + m_receive_offset, l_size);
+                        m_receive_offset += l_size;
+                        if (m_receive_offset == m_receive_buffer.size()) {
+                            m_receive_buffer.clear();
+                            m_receive_offset = 0;
+                        }
+                        m_multiplexer.consumed(*this, l_size);
+                        return l_size;
+                    }
+                    if (m_reset) {
+                        m_error = tristan::sockets::makeError(tristan::sockets::Error::MUX_STREAM_RESET);
+                        return 0;
+                    }
+                    if (m_fin_received) {
+                        m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_EOF);
+                        return 0;
+                    }
+                    if (m_multiplexer.m_error) {
+                        m_error = m_multiplexer.m_error;
+                        return 0;
+                    }
+                    if (p_buffer.empty()) {
+                        return 0;
+                    }
+                    m_multiplexer.poll();
+                    if (m_multiplexer.m_socket.nonBlocking() && Stream::available() == 0 && not m_fin_received && not m_reset) {
+                        m_error = m_multiplexer.m_error ? m_multiplexer.m_error : tristan::sockets::makeError(tristan::sockets::Error::READ_TRY_AGAIN);
+                        return 0;
+                    }
+                }
+            }
+
+            /**
+             * \brief Closes sending side of the stream. Queued data is sent before close
+             */
+            void close() {
+                if (m_fin_queued || m_reset) {
+                    return;
+                }
+                m_fin_queued = true;
+                m_multiplexer.schedule(*this);
+                m_multiplexer.pump();
+            }
+
+            /**
+             * \brief Aborts the stream in both directions discarding queued data
+             */
+            void reset() {
+                if (m_reset) {
+                    return;
+                }
+                m_reset = true;
+                m_send_buffer.clear();
+                m_send_offset = 0;
+                if (not m_fin_sent || not m_fin_received) {
+                    m_multiplexer.queueControl(FrameType::RESET, m_id, {});
+                    m_multiplexer.pump();
+                }
+                m_multiplexer.release(m_id);
+            }
+
+            /**
+             * \brief Returns number of received bytes which were not read yet
+             * \return uint64_t
+             */
+            [[nodiscard]] auto available() const noexcept -> uint64_t { return m_receive_buffer.size() - m_receive_offset; }
+
+            /**
+             * \brief Returns number of bytes which were accepted by write() but not sent yet
+             * \return uint64_t
+             */
+            [[nodiscard]] auto pendingWriteSize() const noexcept -> uint64_t { return m_send_buffer.size() - m_send_offset; }
+
+            /**
+             * \brief Returns number of bytes which may be sent before peer grants more credit
+             * \return uint64_t
+             */
+            [[nodiscard]] auto sendWindow() const noexcept -> uint64_t { return m_send_window; }
+
+            /**
+             * \brief Returns stream id
+             * \return uint32_t
+             */
+            [[nodiscard]] auto id() const noexcept -> uint32_t { return m_id; }
+
+            /**
+             * \brief Returns true if peer closed its sending side and all data was read
+             * \return bool
+             */
+            [[nodiscard]] auto eof() const noexcept -> bool { return m_fin_received && Stream::available() == 0; }
+
+            /**
+             * \brief Returns error of the last operation
+             * \return std::error_code
+             */
+            [[nodiscard]] auto error() const noexcept -> std::error_code { return m_error; }
+
+        private:
+            friend class Multiplexer;
+
+            Stream(Multiplexer& p_multiplexer, uint32_t p_id) :
+                m_multiplexer(p_multiplexer),
+                m_receive_offset(0),
+                m_send_offset(0),
+                m_send_window(p_multiplexer.m_window),
+                m_receive_window(p_multiplexer.m_window),
+                m_consumed(0),
+                m_id(p_id),
+                m_fin_queued(false),
+                m_fin_sent(false),
+                m_fin_received(false),
+                m_reset(false),
+                m_scheduled(false) { }
+
+            Multiplexer& m_multiplexer;
+
+            std::vector< uint8_t > m_receive_buffer;
+            uint64_t m_receive_offset;
+
+            std::vector< uint8_t > m_send_buffer;
+            uint64_t m_send_offset;
+
+            std::error_code m_error;
+
+            uint64_t m_send_window;
+            uint64_t m_receive_window;
+            uint64_t m_consumed;
+
+            uint32_t m_id;
+
+            bool m_fin_queued;
+            bool m_fin_sent;
+            bool m_fin_received;
+            bool m_reset;
+            bool m_scheduled;
+        };
+
+        /**
+         * \brief Constructor
+         * \param p_socket Socket&. Should be connected and outlive the multiplexer
+         * \param p_role MultiplexerRole
+         * \param p_window uint32_t initial flow control window of each stream. Default is 256 KiB
+         * \param p_chunk_size uint32_t maximum amount of stream data in one frame. Default is 16 KiB
+         */
+        explicit Multiplexer(Socket& p_socket, MultiplexerRole p_role, uint32_t p_window = 256 * 1024, uint32_t p_chunk_size = 16 * 1024) :
+            m_framer(p_socket, FramePrefix::FIXED_32, header_size + std::max< uint32_t >(p_chunk_size, 1)),
+            m_socket(p_socket),
+            m_window(std::max< uint32_t >(p_window, 1)),
+            m_chunk_size(std::max< uint32_t >(p_chunk_size, 1)),
+            m_next_id(p_role == MultiplexerRole::CLIENT ? 1 : 2),
+            m_last_remote_id(0),
+            m_heartbeat_interval(0),
+            m_heartbeat_timeout(0),
+            m_last_activity(std::chrono::steady_clock::now()),
+            m_role(p_role),
+            m_ping_outstanding(false) { }
+
+        Multiplexer(const Multiplexer&) = delete;
+        Multiplexer(Multiplexer&&) = delete;
+        Multiplexer& operator=(const Multiplexer&) = delete;
+        Multiplexer& operator=(Multiplexer&&) = delete;
+        ~Multiplexer() = default;
+
+        /**
+         * \brief Opens new stream. Peer learns about the stream with its first data or close
+         * \return std::shared_ptr< Stream >. nullptr if stream ids are exhausted or connection failed
+         */
+        [[nodiscard]] auto openStream() -> std::shared_ptr< Stream > {
+            if (m_error || m_next_id > std::numeric_limits< uint32_t >::max() - 2) {
+                return nullptr;
+            }
+            auto l_stream = std::shared_ptr< Stream >(new Stream(*this, m_next_id));
+            m_streams.emplace(m_next_id, l_stream);
+            m_next_id += 2;
+            return l_stream;
+        }
+
+        /**
+         * \brief Returns next stream opened by peer.
+         * Blocking socket waits until stream is opened, non blocking returns nullptr if there is none
+         * \return std::shared_ptr< Stream >. nullptr on error
+         */
+        [[nodiscard]] auto acceptStream() -> std::shared_ptr< Stream > {
+            while (true) {
+                while (not m_accept_queue.empty()) {
+                    auto l_id = m_accept_queue.front();
+                    m_accept_queue.pop_front();
+                    auto l_stream = m_streams.find(l_id);
+                    if (l_stream != m_streams.end()) {
+                        return l_stream->second;
+                    }
+                }
+                if (m_error) {
+                    return nullptr;
+                }
+                Multiplexer::poll();
+                if (m_socket.nonBlocking() && m_accept_queue.empty()) {
+                    return nullptr;
+                }
+            }
+        }
+
+        /**
+         * \brief Sends queued data of streams and processes frames received with single read call
+         * \return bool. False if connection failed
+         */
+        auto poll() -> bool {
+            if (m_error) {
+                return false;
+            }
+            Multiplexer::pump();
+            auto l_frames = m_framer.readFrames();
+            auto l_read_error = m_framer.error();
+            m_framer.resetError();
+            if (not l_frames.empty()) {
+                m_last_activity = std::chrono::steady_clock::now();
+                m_ping_outstanding = false;
+            }
+            for (auto l_frame: l_frames) {
+                if (not Multiplexer::dispatch(l_frame)) {
+                    return false;
+                }
+            }
+            Multiplexer::pump();
+            if (l_read_error && l_read_error != tristan::sockets::makeError(tristan::sockets::Error::READ_TRY_AGAIN)) {
+                Multiplexer::fail(l_read_error);
+            }
+            Multiplexer::heartbeat();
+            return not m_error;
+        }
+
+        /**
+         * \brief Enables heartbeat. PING is sent when nothing was received for p_interval,
+         * connection fails with tristan::sockets::Error::PEER_DEAD when nothing is received within p_timeout after it.
+         * Heartbeat is checked by poll(), so with non blocking socket poll() should be called at least every timeUntilHeartbeat()
+         * \param p_interval std::chrono::milliseconds. 0 disables heartbeat
+         * \param p_timeout std::chrono::milliseconds
+         */
+        void setHeartbeat(std::chrono::milliseconds p_interval, std::chrono::milliseconds p_timeout) {
+            m_heartbeat_interval = std::max(p_interval, std::chrono::milliseconds(0));
+            m_heartbeat_timeout = std::max(p_timeout, std::chrono::milliseconds(0));
+            m_last_activity = std::chrono::steady_clock::now();
+            m_ping_outstanding = false;
+        }
+
+        /**
+         * \brief Returns time until poll() should be called to send PING or detect dead peer
+         * \return std::chrono::milliseconds. Maximum value if heartbeat is disabled
+         */
+        [[nodiscard]] auto timeUntilHeartbeat() const -> std::chrono::milliseconds {
+            if (m_heartbeat_interval.count() == 0 || m_error) {
+                return std::chrono::milliseconds::max();
+            }
+            auto l_deadline = m_ping_outstanding ? m_ping_sent + m_heartbeat_timeout : m_last_activity + m_heartbeat_interval;
+            auto l_left = std::chrono::ceil< std::chrono::milliseconds >(l_deadline - std::chrono::steady_clock::now());
+            return std::max(l_left, std::chrono::milliseconds(0));
+        }
+
+        /**
+         * \brief Returns number of open streams
+         * \return uint64_t
+         */
+        [[nodiscard]] auto streamCount() const noexcept -> uint64_t { return m_streams.size(); }
+
+        /**
+         * \brief Returns connection error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code { return m_error; }
+
+    private:
+        Framer< Socket > m_framer;
+
+        Socket& m_socket;
+
+        std::unordered_map< uint32_t, std::shared_ptr< Stream > > m_streams;
+        std::deque< uint32_t > m_scheduled;
+        std::deque< uint32_t > m_accept_queue;
+
+        std::error_code m_error;
+
+        uint32_t m_window;
+        uint32_t m_chunk_size;
+        uint32_t m_next_id;
+        uint32_t m_last_remote_id;
+
+        std::chrono::milliseconds m_heartbeat_interval;
+        std::chrono::milliseconds m_heartbeat_timeout;
+        std::chrono::steady_clock::time_point m_last_activity;
+        std::chrono::steady_clock::time_point m_ping_sent;
+
+        MultiplexerRole m_role;
+
+        bool m_ping_outstanding;
+
+        void schedule(Stream& p_stream) {
+            if (not p_stream.m_scheduled) {
+                p_stream.m_scheduled = true;
+                m_scheduled.push_back(p_stream.m_id);
+            }
+        }
+
+        void queueControl(FrameType p_type, uint32_t p_id, std::span< const uint8_t > p_body) {
+            uint8_t l_header[header_size];
+            l_header[0] = static_cast< uint8_t >(p_type);
+            for (uint8_t i = 0; i < 4; ++i) {
+                l_header[4 - i] = static_cast< uint8_t >(p_id >> (i * 8));
+            }
+            m_framer.queueFrame({l_header, header_size}, p_body);
+        }
+
+        void pump() {
+            if (m_error) {
+                return;
+            }
+            while (not m_scheduled.empty()) {
+                auto l_id = m_scheduled.front();
+                m_scheduled.pop_front();
+                auto l_iterator = m_streams.find(l_id);
+                if (l_iterator == m_streams.end()) {
+                    continue;
+                }
+                auto& l_stream = *l_iterator->second;
+                l_stream.m_scheduled = false;
+                auto l_chunk = std::min< uint64_t >({l_stream.pendingWriteSize(), l_stream.m_send_window, m_chunk_size});
+                if (l_chunk > 0) {
+                    Multiplexer::queueControl(FrameType::DATA, l_id, {l_stream.m_send_buffer.data() + l_stream.m_send_offset, l_chunk});
+                    l_stream.m_send_offset += l_chunk;
+                    l_stream.m_send_window -= l_chunk;
+                }
+                if (l_stream.pendingWriteSize() > 0) {
+                    if (l_stream.m_send_window > 0) {
+                        Multiplexer::schedule(l_stream);
+                    }
+                } else if (l_stream.m_fin_queued && not l_stream.m_fin_sent) {
+                    Multiplexer::queueControl(FrameType::FIN, l_id, {});
+                    l_stream.m_fin_sent = true;
+                    if (l_stream.m_fin_received) {
+                        Multiplexer::release(l_id);
+                    }
+                }
+                if (m_framer.pendingWriteSize() >= flush_threshold && not Multiplexer::flush()) {
+                    return;
+                }
+            }
+            Multiplexer::flush();
+        }
+
+        auto flush() -> bool {
+            m_framer.flush();
+            auto l_error = m_framer.error();
+            if (not l_error) {
+                return true;
+            }
+            m_framer.resetError();
+            if (l_error != tristan::sockets::makeError(tristan::sockets::Error::WRITE_TRY_AGAIN)) {
+                Multiplexer::fail(l_error);
+            }
+            return false;
+        }
+
+        void consumed(Stream& p_stream, uint64_t p_size) {
+            if (p_stream.m_fin_received || p_stream.m_reset) {
+                return;
+            }
+            p_stream.m_consumed += p_size;
+            if (p_stream.m_consumed < m_window / 2) {
+                return;
+            }
+            uint8_t l_increment[4];
+            for (uint8_t i = 0; i < 4; ++i) {
+                l_increment[3 - i] = static_cast< uint8_t >(p_stream.m_consumed >> (i * 8));
+            }
+            p_stream.m_receive_window += p_stream.m_consumed;
+            p_stream.m_consumed = 0;
+            Multiplexer::queueControl(FrameType::WINDOW_UPDATE, p_stream.m_id, l_increment);
+            Multiplexer::pump();
+        }
+
+        void release(uint32_t p_id) { m_streams.erase(p_id); }
+
+        auto dispatch(std::span< const uint8_t > p_frame) -> bool {
+            if (p_frame.size() < header_size || p_frame[0] > static_cast< uint8_t >(FrameType::PONG)) {
+                Multiplexer::fail(tristan::sockets::makeError(tristan::sockets::Error::MUX_PROTOCOL_ERROR));
+                return false;
+            }
+            auto l_type = static_cast< FrameType >(p_frame[0]);
+            uint32_t l_id = 0;
+            for (uint8_t i = 1; i < header_size; ++i) {
+                l_id = (l_id << 8) | p_frame[i];
+            }
+            auto l_body = p_frame.subspan(header_size);
+
+            if (l_type == FrameType::PING) {
+                Multiplexer::queueControl(FrameType::PONG, l_id, l_body);
+                return true;
+            }
+            if (l_type == FrameType::PONG) {
+                return true;
+            }
+
+            auto l_iterator = m_streams.find(l_id);
+            if (l_iterator == m_streams.end()) {
+                bool l_remote_id = l_id != 0 && (l_id % 2 == 1) == (m_role == MultiplexerRole::SERVER);
+                if (not l_remote_id || l_id <= m_last_remote_id || (l_type != FrameType::DATA && l_type != FrameType::FIN)) {
+                    return true;
+                }
+                m_last_remote_id = l_id;
+                l_iterator = m_streams.emplace(l_id, std::shared_ptr< Stream >(new Stream(*this, l_id))).first;
+                m_accept_queue.push_back(l_id);
+            }
+            auto l_stream = l_iterator->second;
+
+            switch (l_type) {
+                case FrameType::DATA: {
+                    if (l_stream->m_fin_received) {
+                        Multiplexer::fail(tristan::sockets::makeError(tristan::sockets::Error::MUX_PROTOCOL_ERROR));
+                        return false;
+                    }
+                    if (l_body.size() > l_stream->m_receive_window) {
+                        Multiplexer::fail(tristan::sockets::makeError(tristan::sockets::Error::MUX_FLOW_CONTROL_VIOLATION));
+                        return false;
+                    }
+                    l_stream->m_receive_window -= l_body.size();
+                    l_stream->m_receive_buffer.insert(l_stream->m_receive_buffer.end(), l_body.begin(), l_body.end());
+                    break;
+                }
+                case FrameType::WINDOW_UPDATE: {
+                    if (l_body.size() != 4) {
+                        Multiplexer::fail(tristan::sockets::makeError(tristan::sockets::Error::MUX_PROTOCOL_ERROR));
+                        return false;
+                    }
+                    uint32_t l_increment = 0;
+                    for (auto l_byte: l_body) {
+                        l_increment = (l_increment << 8) | l_byte;
+                    }
+                    l_stream->m_send_window += l_increment;
+                    if (l_stream->pendingWriteSize() > 0) {
+                        Multiplexer::schedule(*l_stream);
+                    }
+                    break;
+                }
+                case FrameType::FIN: {
+                    l_stream->m_fin_received = true;
+                    if (l_stream->m_fin_sent) {
+                        Multiplexer::release(l_id);
+                    }
+                    break;
+                }
+                case FrameType::RESET: {
+                    l_stream->m_reset = true;
+                    l_stream->m_fin_received = true;
+                    l_stream->m_send_buffer.clear();
+                    l_stream->m_send_offset = 0;
+                    Multiplexer::release(l_id);
+                    break;
+                }
+                case FrameType::PING:
+                case FrameType::PONG: {
+                    break;
+                }
+            }
+            return true;
+        }
+
+        void heartbeat() {
+            if (m_error || m_heartbeat_interval.count() == 0) {
+                return;
+            }
+            auto l_now = std::chrono::steady_clock::now();
+            if (m_ping_outstanding) {
+                if (l_now - m_ping_sent >= m_heartbeat_timeout) {
+                    Multiplexer::fail(tristan::sockets::makeError(tristan::sockets::Error::PEER_DEAD));
+                }
+                return;
+            }
+            if (l_now - m_last_activity >= m_heartbeat_interval) {
+                Multiplexer::queueControl(FrameType::PING, 0, {});
+                m_ping_sent = l_now;
+                m_ping_outstanding = true;
+                Multiplexer::pump();
+            }
+        }
+
+        void fail(std::error_code p_error) {
+            if (not m_error) {
+                m_error = p_error;
+            }
+            m_streams.clear();
+            m_scheduled.clear();
+        }
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_MULTIPLEXER_HPP
@@ -0,0 +1,360 @@
+#ifndef SOCKETS_PIPELINED_CLIENT_HPP
+#define SOCKETS_PIPELINED_CLIENT_HPP
+
+#include "framer.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
+#include <span>
+#include <system_error>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Way responses are matched with requests
+     */
+    enum class Correlation : uint8_t {
+        /**
+         * \brief Responses arrive in the order requests were sent
+         */
+        FIFO,
+        /**
+         * \brief Each request and response payload starts with eight bytes correlation id in network byte order.
+         * Server echoes the id and is free to respond out of order
+         */
+        ID
+    };
+
+    /**
+     * \brief Client which keeps up to window requests in flight over single connection
+     * Requests and responses are carried in length prefixed frames.
+     * \tparam Socket InetSocket or IpcSocket
+     */
+    template < class Socket > class PipelinedClient {
+    public:
+        /**
+         * \brief Response payload
+         */
+        using Response = std::vector< uint8_t >;
+        /**
+         * \brief Completion callback. Payload view is valid only during the call
+         */
+        using Callback = std::function< void(std::error_code, std::span< const uint8_t >) >;
+
+        /**
+         * \brief Size of correlation id in bytes
+         */
+        static constexpr uint8_t correlation_id_size = 8;
+
+        /**
+         * \brief Constructor
+         * \param p_socket Socket&. Should be connected and outlive the client
+         * \param p_window uint32_t maximum number of requests in flight. Default is 64
+         * \param p_correlation Correlation. Default is Correlation::ID
+         * \param p_prefix FramePrefix. Default is FramePrefix::FIXED_32
+         * \param p_max_frame_size uint64_t. Default is 16 MiB
+         */
+        explicit PipelinedClient(Socket& p_socket,
+                                 uint32_t p_window = 64,
+                                 Correlation p_correlation = Correlation::ID,
+                                 FramePrefix p_prefix = FramePrefix::FIXED_32,
+                                 uint64_t p_max_frame_size = 16 * 1024 * 1024) :
+            m_framer(p_socket, p_prefix, p_max_frame_size),
+            m_socket(p_socket),
+            m_slots(p_window == 0 ? 1 : p_window),
+            m_free(m_slots.size()),
+            m_order(m_slots.size()),
+            m_next_id(0),
+            m_free_count(static_cast< uint32_t >(m_slots.size())),
+            m_order_head(0),
+            m_in_flight(0),
+            m_correlation(p_correlation),
+            m_dispatching(false) {
+            for (uint32_t i = 0; i < m_free_count; ++i) {
+                m_free[i] = m_free_count - 1 - i;
+            }
+        }
+
+        PipelinedClient(const PipelinedClient&) = delete;
+        PipelinedClient(PipelinedClient&&) = delete;
+        PipelinedClient& operator=(const PipelinedClient&) = delete;
+        PipelinedClient& operator=(PipelinedClient&&) = delete;
+
+        /**
+         * \brief Destructor. Requests which are still in flight are completed with tristan::sockets::Error::PIPELINE_CONNECTION_FAILED
+         */
+        ~PipelinedClient() { PipelinedClient::failAll(tristan::sockets::makeError(tristan::sockets::Error::PIPELINE_CONNECTION_FAILED)); }
+
+        /**
+         * \brief Sends request.
+         * If window is full blocking socket polls responses until slot is released,
+         * non blocking one completes the future with tristan::sockets::Error::PIPELINE_WINDOW_FULL.
+         * Slot of completed request is released before its callback is called, so callback may submit next request.
+         * Callback which submits more requests than were released gets tristan::sockets::Error::PIPELINE_WINDOW_FULL, as responses are not read during completion
+         * \param p_request std::span< const uint8_t >
+         * \return std::future< Response >. On failure holds std::system_error
+         */
+        [[nodiscard]] auto submit(std::span< const uint8_t > p_request) -> std::future< Response > {
+            std::promise< Response > l_promise;
+            auto l_future = l_promise.get_future();
+            auto l_index = PipelinedClient::acquire();
+            if (l_index == npos) {
+                l_promise.set_exception(std::make_exception_ptr(std::system_error(PipelinedClient::acquireError())));
+                return l_future;
+            }
+            m_slots[l_index].promise = std::move(l_promise);
+            PipelinedClient::send(l_index, p_request);
+            return l_future;
+        }
+
+        /**
+         * \overload
+         * \brief Sends request. Response is passed to p_callback without copying
+         * \param p_request std::span< const uint8_t >
+         * \param p_callback Callback
+         */
+        void submit(std::span< const uint8_t > p_request, Callback p_callback) {
+            auto l_index = PipelinedClient::acquire();
+            if (l_index == npos) {
+                p_callback(PipelinedClient::acquireError(), {});
+                return;
+            }
+            m_slots[l_index].callback = std::move(p_callback);
+            PipelinedClient::send(l_index, p_request);
+        }
+
+        /**
+         * \brief Sends queued requests and receives responses with single read call.
+         * Does nothing when called from completion callback
+         * \return uint32_t number of completed requests
+         */
+        auto poll() -> uint32_t {
+            if (m_error || m_dispatching) {
+                return 0;
+            }
+            if (m_framer.pendingWriteSize() > 0) {
+                m_framer.flush();
+                if (not PipelinedClient::checkFramer()) {
+                    return 0;
+                }
+            }
+            if (m_in_flight == 0) {
+                return 0;
+            }
+            uint32_t l_completed = 0;
+            auto l_frames = m_framer.readFrames();
+            m_dispatching = true;
+            for (auto l_frame: l_frames) {
+                if (not PipelinedClient::dispatch(l_frame)) {
+                    m_dispatching = false;
+                    return l_completed;
+                }
+                ++l_completed;
+            }
+            m_dispatching = false;
+            PipelinedClient::checkFramer();
+            return l_completed;
+        }
+
+        /**
+         * \brief Polls until all requests in flight are completed or error occurred.
+         * Does nothing when called from completion callback
+         */
+        void drain() {
+            while (m_in_flight > 0 && not m_error && not m_dispatching) {
+                PipelinedClient::poll();
+                if (m_socket.nonBlocking()) {
+                    break;
+                }
+            }
+        }
+
+        /**
+         * \brief Returns number of requests in flight
+         * \return uint32_t
+         */
+        [[nodiscard]] auto inFlight() const noexcept -> uint32_t { return m_in_flight; }
+
+        /**
+         * \brief Returns maximum number of requests in flight
+         * \return uint32_t
+         */
+        [[nodiscard]] auto window() const noexcept -> uint32_t { return static_cast< uint32_t >(m_slots.size()); }
+
+        /**
+         * \brief Returns correlation mode
+         * \return Correlation
+         */
+        [[nodiscard]] auto correlation() const noexcept -> Correlation { return m_correlation; }
+
+        /**
+         * \brief Returns error. Any error is fatal for the connection
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code { return m_error; }
+
+    private:
+        static constexpr uint32_t npos = std::numeric_limits< uint32_t >::max();
+
+        struct Slot {
+            uint64_t id = 0;
+            std::promise< Response > promise;
+            Callback callback;
+            bool active = false;
+        };
+
+        Framer< Socket > m_framer;
+
+        Socket& m_socket;
+
+        std::vector< Slot > m_slots;
+        std::vector< uint32_t > m_free;
+        std::vector< uint32_t > m_order;
+
+        std::error_code m_error;
+
+        uint64_t m_next_id;
+
+        uint32_t m_free_count;
+        uint32_t m_order_head;
+        uint32_t m_in_flight;
+
+        Correlation m_correlation;
+
+        bool m_dispatching;
+
+        [[nodiscard]] auto acquire() -> uint32_t {
+            while (not m_error && m_free_count == 0) {
+                if (m_socket.nonBlocking() || m_dispatching) {
+                    return npos;
+                }
+                PipelinedClient::poll();
+            }
+            if (m_error) {
+                return npos;
+            }
+            auto l_index = m_free[--m_free_count];
+            auto& l_slot = m_slots[l_index];
+            l_slot.id = (m_next_id++ << 32) | l_index;
+            l_slot.active = true;
+            m_order[(m_order_head + m_in_flight) % m_order.size()] = l_index;
+            ++m_in_flight;
+            return l_index;
+        }
+
+        [[nodiscard]] auto acquireError() const -> std::error_code {
+            return m_error ? m_error : tristan::sockets::makeError(tristan::sockets::Error::PIPELINE_WINDOW_FULL);
+        }
+
+        void send(uint32_t p_index, std::span< const uint8_t > p_request) {
+            uint8_t l_header[correlation_id_size];
+            std::span< const uint8_t > l_header_view;
+            if (m_correlation == Correlation::ID) {
+                auto l_id = m_slots[p_index].id;
+                for (uint8_t i = 0; i < correlation_id_size; ++i) {
+                    l_header[correlation_id_size - 1 - i] = static_cast< uint8_t >(l_id >> (i * 8));
+                }
+                l_header_view = {l_header, correlation_id_size};
+            }
+            m_framer.queueFrame(l_header_view, p_request);
+            if (m_framer.error()) {
+                auto l_error = m_framer.error();
+                m_framer.resetError();
+                PipelinedClient::release(p_index, l_error, {});
+                return;
+            }
+            m_framer.flush();
+            PipelinedClient::checkFramer();
+        }
+
+        [[nodiscard]] auto dispatch(std::span< const uint8_t > p_frame) -> bool {
+            if (m_in_flight == 0) {
+                PipelinedClient::failAll(tristan::sockets::makeError(tristan::sockets::Error::PIPELINE_UNKNOWN_CORRELATION_ID));
+                return false;
+            }
+            if (m_correlation == Correlation::FIFO) {
+                PipelinedClient::release(m_order[m_order_head], {}, p_frame);
+                return true;
+            }
+            if (p_frame.size() < correlation_id_size) {
+                PipelinedClient::failAll(tristan::sockets::makeError(tristan::sockets::Error::PIPELINE_UNKNOWN_CORRELATION_ID));
+                return false;
+            }
+            uint64_t l_id = 0;
+            for (uint8_t i = 0; i < correlation_id_size; ++i) {
+                l_id = (l_id << 8) | p_frame[i];
+            }
+            auto l_index = static_cast< uint32_t >(l_id & 0xFFFFFFFF);
+            if (l_index >= m_slots.size() || not m_slots[l_index].active || m_slots[l_index].id != l_id) {
+                PipelinedClient::failAll(tristan::sockets::makeError(tristan::sockets::Error::PIPELINE_UNKNOWN_CORRELATION_ID));
+                return false;
+            }
+            PipelinedClient::release(l_index, {}, p_frame.subspan(correlation_id_size));
+            return true;
+        }
+
+        // Slot is returned to the window before completion, so callback may submit next request without waiting for a free slot
+        void release(uint32_t p_index, std::error_code p_error, std::span< const uint8_t > p_payload) {
+            auto& l_slot = m_slots[p_index];
+            auto l_callback = std::move(l_slot.callback);
+            auto l_promise = std::move(l_slot.promise);
+            l_slot.callback = nullptr;
+            l_slot.promise = {};
+            l_slot.active = false;
+            m_free[m_free_count++] = p_index;
+            --m_in_flight;
+            if (m_in_flight == 0) {
+                m_order_head = 0;
+            } else if (m_order[m_order_head] == p_index) {
+                m_order_head = (m_order_head + 1) % static_cast< uint32_t >(m_order.size());
+            } else {
+                auto l_size = static_cast< uint32_t >(m_order.size());
+                for (uint32_t i = 1; i <= m_in_flight; ++i) {
+                    auto l_position = (m_order_head + i) % l_size;
+                    if (m_order[l_position] == p_index) {
+                        for (uint32_t j = i; j < m_in_flight; ++j) {
+                            m_order[(m_order_head + j) % l_size] = m_order[(m_order_head + j + 1) % l_size];
+                        }
+                        break;
+                    }
+                }
+            }
+            if (l_callback) {
+                l_callback(p_error, p_payload);
+            } else if (p_error) {
+                l_promise.set_exception(std::make_exception_ptr(std::system_error(p_error)));
+            } else {
+                l_promise.set_value(Response(p_payload.begin(), p_payload.end()));
+            }
+        }
+
+        auto checkFramer() -> bool {
+            auto l_error = m_framer.error();
+            if (not l_error) {
+                return true;
+            }
+            if (l_error == tristan::sockets::makeError(tristan::sockets::Error::READ_TRY_AGAIN)
+                || l_error == tristan::sockets::makeError(tristan::sockets::Error::WRITE_TRY_AGAIN)) {
+                m_framer.resetError();
+                return true;
+            }
+            PipelinedClient::failAll(l_error);
+            return false;
+        }
+
+        void failAll(std::error_code p_error) {
+            if (not m_error) {
+                m_error = p_error;
+            }
+            while (m_in_flight > 0) {
+                PipelinedClient::release(m_order[m_order_head], m_error, {});
+            }
+        }
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_PIPELINED_CLIENT_HPP
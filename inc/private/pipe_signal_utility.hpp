@@ -0,0 +1,43 @@
+#ifndef SOCKETS_PIPE_SIGNAL_UTILITY_HPP
+#define SOCKETS_PIPE_SIGNAL_UTILITY_HPP
+
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+
+#include <pthread.h>
+#include <sys/types.h>
+
+namespace tristan::sockets::utility {
+
+    /**
+     * \brief Calls operation which writes to socket but has no MSG_NOSIGNAL, like splice, tee or sendfile.
+     * SIGPIPE is blocked for the call and the one it raised is consumed, so peer which went away does not take the process down.
+     * errno set by the operation is preserved
+     * \tparam Operation callable returning ssize_t
+     * \param p_operation Operation
+     * \return ssize_t value returned by the operation
+     */
+    template < class Operation > auto withoutPipeSignal(Operation p_operation) -> ssize_t {
+        sigset_t l_pipe_signal;
+        sigemptyset(&l_pipe_signal);
+        sigaddset(&l_pipe_signal, SIGPIPE);
+        sigset_t l_pending;
+        sigpending(&l_pending);
+        bool l_was_pending = sigismember(&l_pending, SIGPIPE) == 1;
+        sigset_t l_old_mask;
+        ::pthread_sigmask(SIG_BLOCK, &l_pipe_signal, &l_old_mask);
+        auto l_status = p_operation();
+        auto l_error = errno;
+        if (l_status < 0 && l_error == EPIPE && not l_was_pending) {
+            timespec l_no_wait{};
+            ::sigtimedwait(&l_pipe_signal, nullptr, &l_no_wait);
+        }
+        ::pthread_sigmask(SIG_SETMASK, &l_old_mask, nullptr);
+        errno = l_error;
+        return l_status;
+    }
+
+} //End of tristan::sockets::utility namespace
+
+#endif  //SOCKETS_PIPE_SIGNAL_UTILITY_HPP
@@ -0,0 +1,41 @@
+#ifndef SOCKETS_SOCKET_ERROR_UTILITY_HPP
+#define SOCKETS_SOCKET_ERROR_UTILITY_HPP
+
+#include "socket_error.hpp"
+
+namespace tristan::sockets::utility {
+
+    /**
+     * \brief Converts errno value set by send family functions to tristan::sockets::Error
+     * \param error_number int32_t
+     * \param non_blocking bool. If false EAGAIN is reported as timeout
+     * \return tristan::sockets::Error
+     */
+    [[nodiscard]] auto writeErrorFromErrno(int32_t error_number, bool non_blocking) -> tristan::sockets::Error;
+
+    /**
+     * \brief Converts errno value set by recv family functions to tristan::sockets::Error
+     * \param error_number int32_t
+     * \param non_blocking bool. If false EAGAIN is reported as timeout
+     * \return tristan::sockets::Error
+     */
+    [[nodiscard]] auto readErrorFromErrno(int32_t error_number, bool non_blocking) -> tristan::sockets::Error;
+
+    /**
+     * \brief Converts errno value set by connect or by sendto with MSG_FASTOPEN to tristan::sockets::Error
+     * \param error_number int32_t
+     * \param non_blocking bool. If false EAGAIN and EINPROGRESS are reported as timeout
+     * \return tristan::sockets::Error
+     */
+    [[nodiscard]] auto connectErrorFromErrno(int32_t error_number, bool non_blocking) -> tristan::sockets::Error;
+
+    /**
+     * \brief Converts errno value set by bind of inet socket to tristan::sockets::Error
+     * \param error_number int32_t
+     * \return tristan::sockets::Error
+     */
+    [[nodiscard]] auto bindErrorFromErrno(int32_t error_number) -> tristan::sockets::Error;
+
+} //End of tristan::sockets::utility namespace
+
+#endif  //SOCKETS_SOCKET_ERROR_UTILITY_HPP
@@ -3,7 +3,9 @@
 
 #include <string>
 #include <vector>
+#include <memory_resource>
 #include <memory>
+#include <type_traits>
 
 struct ssl_ctx_st;
 struct ssl_st;
@@ -41,16 +43,19 @@ namespace tristan::sockets {
 
         [[nodiscard]] auto write(const std::vector< uint8_t >& data, uint16_t size = 0, uint64_t offset = 0) -> std::pair< std::error_code, uint64_t >;
 
+        [[nodiscard]] auto write(const uint8_t* data, uint64_t size) -> std::pair< std::error_code, uint64_t >;
+
         template < class ObjectClassToSend >
-        auto write(ObjectClassToSend object) -> std::pair< std::error_code, uint64_t >
-            requires std::is_standard_layout_v< ObjectClassToSend >
+        auto write(const ObjectClassToSend& object) -> std::pair< std::error_code, uint64_t >
+            requires std::is_standard_layout_v< ObjectClassToSend > && std::is_trivially_copyable_v< ObjectClassToSend >
         {
-            std::vector< uint8_t > temp_data(reinterpret_cast< uint8_t* >(object), reinterpret_cast< uint8_t* >(object) + sizeof(object));
-            return Ssl::write(temp_data);
+            return Ssl::write(reinterpret_cast< const uint8_t* >(&object), sizeof(object));
         }
 
         [[nodiscard]] auto read() -> std::pair< std::error_code, uint8_t >;
         [[nodiscard]] auto read(std::vector<uint8_t>& data, uint16_t size) -> std::pair< std::error_code, std::vector< uint8_t > >;
+        [[nodiscard]] auto read(std::pmr::vector<uint8_t>& data, uint16_t size) -> std::pair< std::error_code, uint64_t >;
+        [[nodiscard]] auto read(uint8_t* data, uint64_t size) -> std::pair< std::error_code, uint64_t >;
 
         void shutdown();
 
@@ -0,0 +1,149 @@
+#ifndef SOCKETS_REQUEST_ARENA_HPP
+#define SOCKETS_REQUEST_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Monotonic arena which memory is reclaimed all at once by reset().
+     * Unlike std::pmr::monotonic_buffer_resource blocks are retained on reset, so after warm up requests do not touch the upstream allocator.
+     * Deallocation is a no-op. Object is not thread safe.
+     */
+    class RequestArena : public std::pmr::memory_resource {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_block_size uint64_t size of the first block. Next blocks double in size. Default is 64 KiB
+         * \param p_upstream std::pmr::memory_resource* resource blocks are obtained from. Default is std::pmr::new_delete_resource()
+         */
+        explicit RequestArena(uint64_t p_block_size = 64 * 1024, std::pmr::memory_resource* p_upstream = std::pmr::new_delete_resource());
+
+        RequestArena(const RequestArena&) = delete;
+        RequestArena(RequestArena&&) = delete;
+        RequestArena& operator=(const RequestArena&) = delete;
+        RequestArena& operator=(RequestArena&&) = delete;
+
+        /**
+         * \brief Destructor. Returns all blocks to upstream resource
+         */
+        ~RequestArena() override;
+
+        /**
+         * \brief Makes all memory available again keeping blocks.
+         * All objects allocated from the arena should be destroyed before the call
+         */
+        void reset() noexcept;
+        /**
+         * \brief Resets the arena and returns all blocks except the first one to upstream resource
+         */
+        void release() noexcept;
+
+        /**
+         * \brief Copies data into the arena
+         * \param p_data std::span< const uint8_t >
+         * \return std::span< uint8_t > copy valid until reset
+         */
+        [[nodiscard]] auto copy(std::span< const uint8_t > p_data) -> std::span< uint8_t >;
+        /**
+         * \overload
+         * \brief Copies string into the arena
+         * \param p_string std::string_view
+         * \return std::string_view copy valid until reset
+         */
+        [[nodiscard]] auto copy(std::string_view p_string) -> std::string_view;
+
+        /**
+         * \brief Constructs object in the arena. Destructor is never called, so Type should not own resources outside of the arena
+         * \tparam Type
+         * \tparam Args
+         * \param p_args Args&&...
+         * \return Type*
+         */
+        template < class Type, class... Args > [[nodiscard]] auto make(Args&&... p_args) -> Type* {
+            return ::new (RequestArena::allocate(sizeof(Type), alignof(Type))) Type(std::forward< Args >(p_args)...);
+        }
+
+        /**
+         * \brief Returns number of bytes handed out since last reset
+         * \return uint64_t
+         */
+        [[nodiscard]] auto used() const noexcept -> uint64_t;
+        /**
+         * \brief Returns total size of retained blocks
+         * \return uint64_t
+         */
+        [[nodiscard]] auto capacity() const noexcept -> uint64_t;
+        /**
+         * \brief Returns maximum number of bytes handed out between two resets
+         * \return uint64_t
+         */
+        [[nodiscard]] auto highWatermark() const noexcept -> uint64_t;
+        /**
+         * \brief Returns number of blocks obtained from upstream resource during lifetime of the arena
+         * \return uint64_t
+         */
+        [[nodiscard]] auto upstreamAllocations() const noexcept -> uint64_t;
+
+    protected:
+        auto do_allocate(std::size_t p_bytes, std::size_t p_alignment) -> void* override;
+        void do_deallocate(void* p_pointer, std::size_t p_bytes, std::size_t p_alignment) override;
+        [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& p_other) const noexcept -> bool override;
+
+    private:
+        struct Block {
+            std::byte* data;
+            uint64_t size;
+        };
+
+        std::vector< Block > m_blocks;
+
+        std::pmr::memory_resource* m_upstream;
+
+        uint64_t m_block_size;
+        uint64_t m_current_block;
+        uint64_t m_offset;
+        uint64_t m_used;
+        uint64_t m_high_watermark;
+        uint64_t m_upstream_allocations;
+
+        void addBlock(uint64_t p_minimum_size);
+    };
+
+    /**
+     * \brief Resets the arena when request handling scope is left
+     */
+    class RequestArenaScope {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_arena RequestArena&
+         */
+        explicit RequestArenaScope(RequestArena& p_arena) noexcept :
+            m_arena(p_arena) { }
+
+        RequestArenaScope(const RequestArenaScope&) = delete;
+        RequestArenaScope(RequestArenaScope&&) = delete;
+        RequestArenaScope& operator=(const RequestArenaScope&) = delete;
+        RequestArenaScope& operator=(RequestArenaScope&&) = delete;
+
+        /**
+         * \brief Destructor. Resets the arena
+         */
+        ~RequestArenaScope() { m_arena.reset(); }
+
+    private:
+        RequestArena& m_arena;
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_REQUEST_ARENA_HPP
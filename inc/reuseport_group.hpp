@@ -0,0 +1,115 @@
+#ifndef SOCKETS_REUSEPORT_GROUP_HPP
+#define SOCKETS_REUSEPORT_GROUP_HPP
+
+#include "inet_socket.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Group of listening InetSocket sharing ip and port with SO_REUSEPORT, one listener per CPU.
+     * Classic BPF program attached to the group selects the listener by the CPU which processed the incoming connection, listener i gets connections of CPUs i, i + size(), ...
+     * So when the thread accepting from listener i runs on CPU i, see bindCurrentThread(), connection is handled on the core where its packets arrive.
+     * If the program can not be attached, kernel distributes connections by hash and steering() returns false.
+     * Connection which was processed by a CPU of another listener is handed off to the queue of that listener and returned by its accept().
+     * accept() may be called concurrently for different listeners
+     */
+    class ReuseportGroup {
+    public:
+        /**
+         * \brief Constructor. Creates, binds and starts listening on all listeners
+         * \param p_ip uint32_t - IP in network byte order
+         * \param p_port uint16_t - port in network byte order
+         * \param p_listener_count uint32_t. 0 means number of CPUs
+         * \param p_connection_count_limit uint32_t backlog of each listener. Default is 1024
+         * \param p_options SocketOptions applied to listeners and accepted sockets. reuse_port is always enabled
+         */
+        ReuseportGroup(uint32_t p_ip, uint16_t p_port, uint32_t p_listener_count = 0, uint32_t p_connection_count_limit = 1024, SocketOptions p_options = {});
+
+        ReuseportGroup(const ReuseportGroup&) = delete;
+        ReuseportGroup(ReuseportGroup&&) = delete;
+        ReuseportGroup& operator=(const ReuseportGroup&) = delete;
+        ReuseportGroup& operator=(ReuseportGroup&&) = delete;
+        ~ReuseportGroup();
+
+        /**
+         * \brief Accepts connection of the listener.
+         * Connections handed off by other listeners are returned first. Accepted connection which belongs to another listener is handed off to it and the next one is accepted.
+         * Blocking listener waits for its own connection or for a handed off one, non blocking returns std::nullopt with ACCEPT_TRY_AGAIN error of the listener,
+         * then both listener and handoffHandle() should be polled for input
+         * \param p_index uint32_t index of the listener, which is the CPU the calling thread should run on
+         * \return std::optional< std::unique_ptr< InetSocket > >
+         */
+        [[nodiscard]] auto accept(uint32_t p_index) -> std::optional< std::unique_ptr< InetSocket > >;
+        /**
+         * \brief Returns descriptor which is readable while connections handed off to the listener are waiting in its queue
+         * \param p_index uint32_t
+         * \return int32_t. -1 if p_index is out of range or handoff is not available
+         */
+        [[nodiscard]] auto handoffHandle(uint32_t p_index) const noexcept -> int32_t;
+        /**
+         * \brief Returns listener
+         * \param p_index uint32_t
+         * \return InetSocket&
+         */
+        [[nodiscard]] auto listener(uint32_t p_index) -> InetSocket&;
+        /**
+         * \brief Returns number of listeners
+         * \return uint32_t
+         */
+        [[nodiscard]] auto size() const noexcept -> uint32_t;
+        /**
+         * \brief Returns whether connections are steered to listeners by CPU
+         * \return bool
+         */
+        [[nodiscard]] auto steering() const noexcept -> bool;
+        /**
+         * \brief Returns number of accepted connections which were processed by a CPU of another listener and handed off to it
+         * \return uint64_t
+         */
+        [[nodiscard]] auto misrouted() const noexcept -> uint64_t;
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code;
+
+        /**
+         * \brief Restricts calling thread to the CPU
+         * \param p_cpu uint32_t
+         * \return bool whether affinity was set
+         */
+        static auto bindCurrentThread(uint32_t p_cpu) -> bool;
+
+    private:
+        struct Handoff {
+            std::mutex mutex;
+            std::deque< std::unique_ptr< InetSocket > > sockets;
+            int32_t event = -1;
+        };
+
+        std::vector< std::unique_ptr< InetSocket > > m_listeners;
+        std::vector< std::unique_ptr< Handoff > > m_handoffs;
+
+        std::error_code m_error;
+
+        std::atomic< uint64_t > m_misrouted;
+
+        bool m_steering;
+
+        void attachProgram();
+        auto takeHandedOff(uint32_t p_index) -> std::unique_ptr< InetSocket >;
+        auto handOff(std::unique_ptr< InetSocket >& p_socket, uint32_t p_index) -> bool;
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_REUSEPORT_GROUP_HPP
@@ -7,6 +7,9 @@
 #include <vector>
 #include <optional>
 #include <memory>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
 
 namespace tristan::sockets {
 
@@ -15,6 +18,12 @@ namespace tristan::sockets {
         DATA
     };
 
+    /**
+     * \brief Concept for objects which may be sent and received as raw bytes of their object representation
+     */
+    template < class Type >
+    concept TriviallySerializable = std::is_standard_layout_v< Type > && std::is_trivially_copyable_v< Type >;
+
 } //End of tristan::sockets namespace
 
 #endif  //SOCKETS_SOCKET_COMMON_HPP
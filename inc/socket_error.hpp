@@ -458,7 +458,119 @@ namespace tristan::sockets {
         /**
          * \brief Insufficient resources were available in the system to perform the operation
          */
-        SHUTDOWN_NOT_ENOUGH_MEMORY
+        SHUTDOWN_NOT_ENOUGH_MEMORY,
+        /**
+         * \brief Frame size exceeds configured maximum
+         */
+        FRAME_TOO_LARGE,
+        /**
+         * \brief Frame length prefix is malformed
+         */
+        FRAME_MALFORMED_PREFIX,
+        /**
+         * \brief HTTP request or status line is malformed
+         */
+        HTTP_MALFORMED_START_LINE,
+        /**
+         * \brief HTTP header line is malformed
+         */
+        HTTP_MALFORMED_HEADER,
+        /**
+         * \brief HTTP message contains more headers than supported
+         */
+        HTTP_TOO_MANY_HEADERS,
+        /**
+         * \brief HTTP message head exceeds configured maximum
+         */
+        HTTP_HEAD_TOO_LARGE,
+        /**
+         * \brief HTTP message body exceeds configured maximum
+         */
+        HTTP_BODY_TOO_LARGE,
+        /**
+         * \brief HTTP chunked transfer coding is malformed
+         */
+        HTTP_MALFORMED_CHUNK,
+        /**
+         * \brief Maximum number of in-flight requests is reached and socket is non blocking
+         */
+        PIPELINE_WINDOW_FULL,
+        /**
+         * \brief Response correlation id does not match any in-flight request
+         */
+        PIPELINE_UNKNOWN_CORRELATION_ID,
+        /**
+         * \brief Request was not completed because connection failed
+         */
+        PIPELINE_CONNECTION_FAILED,
+        /**
+         * \brief WebSocket frame violates the protocol
+         */
+        WEBSOCKET_PROTOCOL_ERROR,
+        /**
+         * \brief WebSocket message size exceeds configured maximum
+         */
+        WEBSOCKET_MESSAGE_TOO_LARGE,
+        /**
+         * \brief WebSocket close frame was already sent
+         */
+        WEBSOCKET_CLOSED,
+        /**
+         * \brief Frame checksum does not match its payload
+         */
+        FRAME_CHECKSUM_MISMATCH,
+        /**
+         * \brief Compressed message is corrupted
+         */
+        DECOMPRESSION_FAILED,
+        /**
+         * \brief Message is compressed with algorithm which is not configured for the stream
+         */
+        COMPRESSION_UNSUPPORTED_ALGORITHM,
+        /**
+         * \brief Multiplexed connection received malformed frame
+         */
+        MUX_PROTOCOL_ERROR,
+        /**
+         * \brief Peer sent more stream data than flow control window allows
+         */
+        MUX_FLOW_CONTROL_VIOLATION,
+        /**
+         * \brief Stream was reset
+         */
+        MUX_STREAM_RESET,
+        /**
+         * \brief Sending side of the stream is closed
+         */
+        MUX_STREAM_CLOSED,
+        /**
+         * \brief Batch datagram operation was called on stream socket
+         */
+        BATCH_NOT_DATAGRAM_SOCKET,
+        /**
+         * \brief Kernel side transfer is not possible on SSL connection
+         */
+        FILE_TRANSFER_WITH_SSL,
+        /**
+         * \brief File could not be read or written during kernel side transfer
+         */
+        FILE_TRANSFER_IO_ERROR,
+        /**
+         * \brief Pipe for splice could not be created
+         */
+        FILE_TRANSFER_PIPE_ERROR,
+        /**
+         * \brief Datagram operation with endpoint was called on stream socket
+         */
+        ENDPOINT_NOT_DATAGRAM_SOCKET,
+        /**
+         * \brief Socket option could not be set
+         */
+        SOCKET_SET_OPTION_ERROR,
+        /**
+         * \brief Peer did not respond within keepalive, user timeout or heartbeat limits
+         */
+        PEER_DEAD
     };
 
     /**
@@ -0,0 +1,138 @@
+#ifndef SOCKETS_SOCKET_OPTIONS_HPP
+#define SOCKETS_SOCKET_OPTIONS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Option of SocketOptions, used to report options which could not be applied
+     */
+    enum class SocketOption : uint8_t {
+        NO_DELAY,
+        QUICK_ACK,
+        PRIORITY,
+        TYPE_OF_SERVICE,
+        REUSE_ADDRESS,
+        REUSE_PORT,
+        SEND_BUFFER_SIZE,
+        RECEIVE_BUFFER_SIZE,
+        KEEP_ALIVE,
+        KEEP_ALIVE_IDLE,
+        KEEP_ALIVE_INTERVAL,
+        KEEP_ALIVE_COUNT,
+        USER_TIMEOUT,
+        ABORTIVE_CLOSE,
+        BIND_ADDRESS_NO_PORT
+    };
+
+    /**
+     * \brief Predefined set of socket options
+     */
+    enum class Profile : uint8_t {
+        /**
+         * \brief No options, kernel defaults are used
+         */
+        DEFAULT,
+        /**
+         * \brief Small messages which should be delivered immediately: Nagle algorithm and delayed acknowledgements are disabled,
+         * packets are prioritised and marked with DSCP EF
+         */
+        LOW_LATENCY,
+        /**
+         * \brief Large transfers: Nagle algorithm is kept, buffers are enlarged and packets are marked with DSCP AF11
+         */
+        BULK,
+        /**
+         * \brief Many short client connections: close resets connection instead of leaving it in TIME_WAIT
+         * and source port is chosen on connect, so ports are shared between destinations
+         */
+        CONNECTION_CHURN
+    };
+
+    /**
+     * \brief Socket options applied by InetSocket on creation and to accepted sockets. Options which are not set are left as kernel defaults.
+     * TCP options are ignored by SocketType::DATA sockets
+     */
+    struct SocketOptions {
+        /**
+         * \brief TCP_NODELAY. Disables Nagle algorithm
+         */
+        std::optional< bool > no_delay;
+        /**
+         * \brief TCP_QUICKACK. Disables delayed acknowledgements. Kernel resets it, so it is set again after each read call which received data
+         */
+        std::optional< bool > quick_ack;
+        /**
+         * \brief SO_PRIORITY. Values above 6 require CAP_NET_ADMIN
+         */
+        std::optional< int32_t > priority;
+        /**
+         * \brief IP_TOS. DSCP in upper six bits and ECN in lower two
+         */
+        std::optional< uint8_t > type_of_service;
+        /**
+         * \brief SO_REUSEADDR
+         */
+        std::optional< bool > reuse_address;
+        /**
+         * \brief SO_REUSEPORT
+         */
+        std::optional< bool > reuse_port;
+        /**
+         * \brief SO_SNDBUF. Kernel doubles the value for bookkeeping overhead
+         */
+        std::optional< uint32_t > send_buffer_size;
+        /**
+         * \brief SO_RCVBUF. Kernel doubles the value for bookkeeping overhead
+         */
+        std::optional< uint32_t > receive_buffer_size;
+        /**
+         * \brief SO_KEEPALIVE. Enables keepalive probes on idle connection
+         */
+        std::optional< bool > keep_alive;
+        /**
+         * \brief TCP_KEEPIDLE. Idle time before the first keepalive probe
+         */
+        std::optional< std::chrono::seconds > keep_alive_idle;
+        /**
+         * \brief TCP_KEEPINTVL. Time between keepalive probes
+         */
+        std::optional< std::chrono::seconds > keep_alive_interval;
+        /**
+         * \brief TCP_KEEPCNT. Number of unanswered keepalive probes after which connection is dropped
+         */
+        std::optional< uint32_t > keep_alive_count;
+        /**
+         * \brief TCP_USER_TIMEOUT. Maximum time sent data may stay unacknowledged before connection is dropped
+         */
+        std::optional< std::chrono::milliseconds > user_timeout;
+        /**
+         * \brief SO_LINGER with zero timeout. Close sends RST and discards unsent data, so socket does not stay in TIME_WAIT
+         */
+        std::optional< bool > abortive_close;
+        /**
+         * \brief IP_BIND_ADDRESS_NO_PORT. Defers choice of source port from InetSocket::bindSource() to connect
+         */
+        std::optional< bool > bind_address_no_port;
+
+        /**
+         * \brief Sets keepalive and user timeout so that dead peer is detected within given time on both idle and busy connection.
+         * Reads and writes on such connection fail with PEER_DEAD error
+         * \param p_detection_time std::chrono::seconds. Should be at least 3 seconds
+         */
+        void setLiveness(std::chrono::seconds p_detection_time);
+
+        /**
+         * \brief Creates options of the profile
+         * \param p_profile Profile
+         * \return SocketOptions
+         */
+        [[nodiscard]] static auto profile(Profile p_profile) -> SocketOptions;
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_SOCKET_OPTIONS_HPP
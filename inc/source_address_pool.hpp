@@ -0,0 +1,97 @@
+#ifndef SOCKETS_SOURCE_ADDRESS_POOL_HPP
+#define SOCKETS_SOURCE_ADDRESS_POOL_HPP
+
+#include "inet_socket.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Local addresses client connections are spread over. Kernel keeps separate set of ephemeral ports for each source address,
+     * so with N addresses N times more connections to the same destination may exist or wait in TIME_WAIT.
+     * Sockets are bound with IP_BIND_ADDRESS_NO_PORT, so port is chosen on connect and shared between destinations.
+     * connect() may be called concurrently
+     */
+    class SourceAddressPool {
+    public:
+        /**
+         * \brief Usage of ephemeral ports by the pool addresses
+         */
+        struct Statistics {
+            /**
+             * \brief First port of ip_local_port_range
+             */
+            uint16_t port_range_begin = 0;
+            /**
+             * \brief Last port of ip_local_port_range
+             */
+            uint16_t port_range_end = 0;
+            /**
+             * \brief Connections started through the pool
+             */
+            uint64_t connections = 0;
+            /**
+             * \brief Connections which failed because no source port was free
+             */
+            uint64_t exhausted = 0;
+            /**
+             * \brief TCP sockets of pool addresses with ephemeral port, except ones in TIME_WAIT
+             */
+            uint64_t ports_in_use = 0;
+            /**
+             * \brief TCP sockets of pool addresses in TIME_WAIT
+             */
+            uint64_t time_wait = 0;
+        };
+
+        /**
+         * \brief Constructor
+         * \param p_ips std::vector< uint32_t > local IPs in network byte order. If empty, kernel chooses source address
+         */
+        explicit SourceAddressPool(std::vector< uint32_t > p_ips);
+
+        SourceAddressPool(const SourceAddressPool&) = delete;
+        SourceAddressPool(SourceAddressPool&&) = delete;
+        SourceAddressPool& operator=(const SourceAddressPool&) = delete;
+        SourceAddressPool& operator=(SourceAddressPool&&) = delete;
+        ~SourceAddressPool() = default;
+
+        /**
+         * \brief Binds socket to the next address in round robin order and connects it to host and port set in the socket.
+         * Errors are reported by the socket, tristan::sockets::Error::CONNECT_ADDRESS_NOT_AVAILABLE means ports of the address are exhausted
+         * and connection should be retried with a new socket, which gets the next address.
+         * Nothing is done if the socket already has an error or IP_BIND_ADDRESS_NO_PORT can not be set, see InetSocket::failedOptions()
+         * \param p_socket InetSocket& stream socket which is not bound
+         * \param p_ssl bool. Default is true
+         */
+        void connect(InetSocket& p_socket, bool p_ssl = true);
+        /**
+         * \brief Returns next address in round robin order
+         * \return uint32_t. 0 if pool is empty
+         */
+        [[nodiscard]] auto next() -> uint32_t;
+        /**
+         * \brief Returns number of addresses
+         * \return uint64_t
+         */
+        [[nodiscard]] auto size() const noexcept -> uint64_t;
+        /**
+         * \brief Collects ephemeral port usage. Reads ip_local_port_range and TCP socket table from /proc, so should not be called per connection
+         * \return Statistics
+         */
+        [[nodiscard]] auto statistics() const -> Statistics;
+
+    private:
+        std::vector< uint32_t > m_ips;
+
+        std::atomic< uint64_t > m_next;
+        std::atomic< uint64_t > m_connections;
+        std::atomic< uint64_t > m_exhausted;
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_SOURCE_ADDRESS_POOL_HPP
@@ -0,0 +1,179 @@
+#ifndef SOCKETS_SPLICE_RELAY_HPP
+#define SOCKETS_SPLICE_RELAY_HPP
+
+#include "socket_error.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <system_error>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Direction of relayed data
+     */
+    enum class RelayDirection : uint8_t {
+        FIRST_TO_SECOND,
+        SECOND_TO_FIRST
+    };
+
+    /**
+     * \brief Bidirectional relay between two connected stream sockets, e.g. accepted InetSocket and upstream InetSocket or IpcSocket.
+     * Data is moved by kernel with splice through a pipe per direction and never copied to user space.
+     * When one side finishes sending, the other side is shut down for writing once all data is delivered.
+     * When destination is slow, data is kept in the pipe and source is not read until pipe has free space.
+     * Sockets are switched to non blocking mode and should outlive the relay. Sockets with SSL can not be relayed.
+     * One direction may be mirrored to a shadow socket with tee, see mirror().
+     */
+    class SpliceRelay {
+    public:
+        /**
+         * \brief Constructor
+         * \tparam First InetSocket or IpcSocket
+         * \tparam Second InetSocket or IpcSocket
+         * \param p_first First&
+         * \param p_second Second&
+         * \param p_pipe_size uint64_t requested capacity of each pipe. Default is 1 MiB
+         */
+        template < class First, class Second >
+        SpliceRelay(First& p_first, Second& p_second, uint64_t p_pipe_size = 1024 * 1024) :
+            m_finished(false) {
+            if constexpr (requires { p_first.encrypted(); }) {
+                if (p_first.encrypted()) {
+                    m_error = tristan::sockets::makeError(tristan::sockets::Error::FILE_TRANSFER_WITH_SSL);
+                }
+            }
+            if constexpr (requires { p_second.encrypted(); }) {
+                if (p_second.encrypted()) {
+                    m_error = tristan::sockets::makeError(tristan::sockets::Error::FILE_TRANSFER_WITH_SSL);
+                }
+            }
+            p_first.setNonBlocking();
+            p_second.setNonBlocking();
+            SpliceRelay::init(p_first.nativeHandle(), p_second.nativeHandle(), p_pipe_size);
+        }
+
+        SpliceRelay(const SpliceRelay&) = delete;
+        SpliceRelay(SpliceRelay&&) = delete;
+        SpliceRelay& operator=(const SpliceRelay&) = delete;
+        SpliceRelay& operator=(SpliceRelay&&) = delete;
+
+        /**
+         * \brief Destructor. Closes pipes. Data which was not delivered yet is lost
+         */
+        ~SpliceRelay();
+
+        /**
+         * \brief Duplicates data of one direction to a shadow socket, e.g. to test new version of a backend on live traffic.
+         * Data is duplicated with tee before it is delivered, so primary path is not copied.
+         * When shadow does not keep up, mirrored data is dropped and counted, primary path is never slowed down.
+         * Data sent by shadow is read and discarded until shadow closes its side. Errors of shadow, including broken pipe, disable mirroring and are reported by mirrorError() only.
+         * Should be called before relaying starts
+         * \tparam Shadow InetSocket or IpcSocket
+         * \param p_shadow Shadow&. Connected socket which is switched to non blocking mode and should outlive the relay
+         * \param p_direction RelayDirection. Default is RelayDirection::FIRST_TO_SECOND
+         */
+        template < class Shadow > void mirror(Shadow& p_shadow, RelayDirection p_direction = RelayDirection::FIRST_TO_SECOND) {
+            if constexpr (requires { p_shadow.encrypted(); }) {
+                if (p_shadow.encrypted()) {
+                    m_mirror_error = tristan::sockets::makeError(tristan::sockets::Error::FILE_TRANSFER_WITH_SSL);
+                    return;
+                }
+            }
+            p_shadow.setNonBlocking();
+            SpliceRelay::initMirror(p_shadow.nativeHandle(), p_direction);
+        }
+
+        /**
+         * \brief Moves as much data as possible in both directions without blocking. Suitable for use from event loop
+         * \return uint64_t number of bytes delivered during the call
+         */
+        auto poll() -> uint64_t;
+        /**
+         * \brief Relays data until both directions are finished or an error occurs
+         * \param p_idle_timeout std::chrono::milliseconds. If no data moves during this time, SOCKET_TIMED_OUT error is set and function returns. Negative value means no timeout
+         * \return uint64_t number of bytes delivered during the call
+         */
+        auto run(std::chrono::milliseconds p_idle_timeout = std::chrono::milliseconds(-1)) -> uint64_t;
+
+        /**
+         * \brief Returns number of bytes delivered from first socket to second
+         * \return uint64_t
+         */
+        [[nodiscard]] auto bytesFirstToSecond() const noexcept -> uint64_t;
+        /**
+         * \brief Returns number of bytes delivered from second socket to first
+         * \return uint64_t
+         */
+        [[nodiscard]] auto bytesSecondToFirst() const noexcept -> uint64_t;
+        /**
+         * \brief Returns number of bytes delivered to shadow socket
+         * \return uint64_t
+         */
+        [[nodiscard]] auto bytesMirrored() const noexcept -> uint64_t;
+        /**
+         * \brief Returns number of bytes which were not mirrored because shadow did not keep up or failed
+         * \return uint64_t
+         */
+        [[nodiscard]] auto bytesMirrorDropped() const noexcept -> uint64_t;
+        /**
+         * \brief Returns error of shadow socket
+         * \return std::error_code
+         */
+        [[nodiscard]] auto mirrorError() const noexcept -> std::error_code;
+        /**
+         * \brief Returns whether both directions are finished or relay failed
+         * \return bool
+         */
+        [[nodiscard]] auto finished() const noexcept -> bool;
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code;
+
+    private:
+        struct Direction {
+            std::array< int32_t, 2 > pipe{-1, -1};
+            std::array< int32_t, 2 > staging_pipe{-1, -1};
+            int32_t source = -1;
+            int32_t destination = -1;
+            uint64_t pipe_capacity = 0;
+            uint64_t bytes_in_pipe = 0;
+            uint64_t bytes_in_staging_pipe = 0;
+            uint64_t bytes_delivered = 0;
+            bool source_finished = false;
+            bool destination_shut_down = false;
+        };
+
+        struct Mirror {
+            std::array< int32_t, 2 > pipe{-1, -1};
+            int32_t shadow = -1;
+            uint64_t bytes_in_pipe = 0;
+            uint64_t bytes_delivered = 0;
+            uint64_t bytes_dropped = 0;
+            uint8_t direction = 0;
+            bool active = false;
+            bool shut_down = false;
+            bool peer_closed = false;
+        };
+
+        std::array< Direction, 2 > m_directions;
+        Mirror m_mirror;
+
+        std::error_code m_error;
+        std::error_code m_mirror_error;
+
+        bool m_finished;
+
+        void init(int32_t p_first, int32_t p_second, uint64_t p_pipe_size);
+        void initMirror(int32_t p_shadow, RelayDirection p_direction);
+        auto pump(Direction& p_direction, bool p_mirrored) -> uint64_t;
+        void pumpMirror();
+        void stopMirror(std::error_code p_error);
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_SPLICE_RELAY_HPP
@@ -0,0 +1,398 @@
+#ifndef SOCKETS_WEBSOCKET_HPP
+#define SOCKETS_WEBSOCKET_HPP
+
+#include "socket_error.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace tristan::sockets {
+
+    /**
+     * \brief WebSocket frame opcode
+     */
+    enum class WebSocketOpcode : uint8_t {
+        CONTINUATION = 0x0,
+        TEXT = 0x1,
+        BINARY = 0x2,
+        CLOSE = 0x8,
+        PING = 0x9,
+        PONG = 0xA
+    };
+
+    /**
+     * \brief Side of WebSocket connection.
+     * Client masks outgoing frames, server requires incoming frames to be masked
+     */
+    enum class WebSocketRole : uint8_t {
+        CLIENT,
+        SERVER
+    };
+
+    /**
+     * \brief Complete WebSocket message
+     */
+    struct WebSocketMessage {
+        /**
+         * \brief Opcode of the first frame of the message. Never WebSocketOpcode::CONTINUATION
+         */
+        WebSocketOpcode opcode;
+        /**
+         * \brief Unmasked payload
+         */
+        std::span< const uint8_t > payload;
+    };
+
+    /**
+     * \brief Low level WebSocket frame encoding routines
+     */
+    class WebSocketCodec {
+    public:
+        /**
+         * \brief Maximum size of frame header in bytes
+         */
+        static constexpr uint8_t max_header_size = 14;
+
+        /**
+         * \brief Masks or unmasks data in place
+         * \param p_data std::span< uint8_t >
+         * \param p_key std::array< uint8_t, 4 > masking key in wire order
+         * \param p_offset uint64_t offset of p_data from the beginning of the frame payload. Default is 0
+         */
+        static void applyMask(std::span< uint8_t > p_data, std::array< uint8_t, 4 > p_key, uint64_t p_offset = 0) noexcept;
+        /**
+         * \brief Copies masked data. p_destination should point to at least p_source.size() bytes
+         * \param p_source std::span< const uint8_t >
+         * \param p_destination uint8_t*
+         * \param p_key std::array< uint8_t, 4 > masking key in wire order
+         * \param p_offset uint64_t offset of p_source from the beginning of the frame payload. Default is 0
+         */
+        static void copyMasked(std::span< const uint8_t > p_source, uint8_t* p_destination, std::array< uint8_t, 4 > p_key, uint64_t p_offset = 0) noexcept;
+        /**
+         * \brief Encodes frame header
+         * \param p_opcode WebSocketOpcode
+         * \param p_fin bool. True if frame is the last one of the message
+         * \param p_payload_size uint64_t
+         * \param p_key const std::array< uint8_t, 4 >*. Masking key or nullptr if frame is not masked
+         * \param p_destination uint8_t*. Should point to at least max_header_size bytes
+         * \return uint8_t number of bytes written
+         */
+        static auto encodeHeader(WebSocketOpcode p_opcode, bool p_fin, uint64_t p_payload_size, const std::array< uint8_t, 4 >* p_key, uint8_t* p_destination) noexcept
+            -> uint8_t;
+    };
+
+    /**
+     * \brief Class which extracts WebSocket messages from receive buffer.
+     * Payload is unmasked in place and fragments of a message are joined inside the receive buffer,
+     * so messages are returned as views which are valid until next call to next() or receiveSpace().
+     * Control frames interleaved with fragments are returned as soon as they are received.
+     */
+    class WebSocketParser {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_role WebSocketRole of the local side
+         * \param p_max_message_size uint64_t. Default is 16 MiB
+         * \param p_buffer_size uint64_t initial size of receive buffer. Default is 64 KiB
+         */
+        explicit WebSocketParser(WebSocketRole p_role, uint64_t p_max_message_size = 16 * 1024 * 1024, uint64_t p_buffer_size = 64 * 1024);
+
+        /**
+         * \brief Returns free space of the receive buffer.
+         * Views returned by previous call to next() are invalidated.
+         * \return std::span< uint8_t >
+         */
+        [[nodiscard]] auto receiveSpace() -> std::span< uint8_t >;
+        /**
+         * \brief Marks p_size bytes of space returned by receiveSpace() as received
+         * \param p_size uint64_t
+         */
+        void commit(uint64_t p_size);
+        /**
+         * \brief Extracts next complete message
+         * \return std::optional< WebSocketMessage >. std::nullopt if more data is needed or error occurred
+         */
+        [[nodiscard]] auto next() -> std::optional< WebSocketMessage >;
+        /**
+         * \brief Returns size of the frame which is received partially including header
+         * \return uint64_t. 0 if there is no partially received frame or its size is not known yet
+         */
+        [[nodiscard]] auto pendingFrameSize() const noexcept -> uint64_t;
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code;
+
+    private:
+        std::vector< uint8_t > m_buffer;
+
+        std::error_code m_error;
+
+        uint64_t m_max_message_size;
+        uint64_t m_begin;
+        uint64_t m_end;
+        uint64_t m_message_begin;
+        uint64_t m_message_size;
+        uint64_t m_pending_frame_size;
+
+        WebSocketOpcode m_message_opcode;
+        WebSocketRole m_role;
+        bool m_fragmented;
+    };
+
+    /**
+     * \brief WebSocket connection over already upgraded InetSocket or IpcSocket.
+     * TLS is handled by the socket itself.
+     * \tparam Socket InetSocket or IpcSocket
+     */
+    template < class Socket > class WebSocket {
+    public:
+        /**
+         * \brief Constructor
+         * \param p_socket Socket&. Should outlive the object
+         * \param p_role WebSocketRole of the local side
+         * \param p_max_message_size uint64_t. Default is 16 MiB
+         */
+        explicit WebSocket(Socket& p_socket, WebSocketRole p_role, uint64_t p_max_message_size = 16 * 1024 * 1024) :
+            m_parser(p_role, p_max_message_size),
+            m_socket(p_socket),
+            m_send_offset(0),
+            m_random(std::random_device{}()),
+            m_close_code(0),
+            m_role(p_role),
+            m_close_sent(false),
+            m_close_received(false) { }
+
+        WebSocket(const WebSocket&) = delete;
+        WebSocket(WebSocket&&) = delete;
+        WebSocket& operator=(const WebSocket&) = delete;
+        WebSocket& operator=(WebSocket&&) = delete;
+        ~WebSocket() = default;
+
+        /**
+         * \brief Reads next message.
+         * Pings are answered with pongs and close frame is answered with close frame automatically, control messages are still returned.
+         * \return std::optional< WebSocketMessage >. Payload view is valid until next call to read().
+         * std::nullopt on error or, in non blocking mode, if more data is needed
+         */
+        [[nodiscard]] auto read() -> std::optional< WebSocketMessage > {
+            m_error = {};
+            while (true) {
+                auto l_message = m_parser.next();
+                if (l_message) {
+                    WebSocket::handleControl(*l_message);
+                    return l_message;
+                }
+                if (m_parser.error()) {
+                    m_error = m_parser.error();
+                    WebSocket::close(1002);
+                    return std::nullopt;
+                }
+                auto l_space = m_parser.receiveSpace();
+                m_socket.resetError();
+                auto l_bytes_read = m_socket.readSome(l_space);
+                m_parser.commit(l_bytes_read);
+                if (l_bytes_read == 0 && m_socket.error()) {
+                    m_error = m_socket.error();
+                    return std::nullopt;
+                }
+            }
+        }
+
+        /**
+         * \brief Sends message in a single frame
+         * \param p_payload std::span< const uint8_t >
+         * \param p_opcode WebSocketOpcode. Default is WebSocketOpcode::BINARY
+         * \return uint64_t number of bytes sent including header
+         */
+        auto write(std::span< const uint8_t > p_payload, WebSocketOpcode p_opcode = WebSocketOpcode::BINARY) -> uint64_t {
+            return WebSocket::writeFrame(p_opcode, true, p_payload);
+        }
+
+        /**
+         * \overload
+         * \brief Sends text message in a single frame
+         * \param p_text std::string_view
+         * \return uint64_t number of bytes sent including header
+         */
+        auto write(std::string_view p_text) -> uint64_t {
+            return WebSocket::writeFrame(WebSocketOpcode::TEXT, true, {reinterpret_cast< const uint8_t* >(p_text.data()), p_text.size()});
+        }
+
+        /**
+         * \brief Sends frame. Allows to send message in fragments
+         * \param p_opcode WebSocketOpcode. Should be WebSocketOpcode::CONTINUATION for all fragments except the first one
+         * \param p_fin bool. True for the last fragment
+         * \param p_payload std::span< const uint8_t >
+         * \return uint64_t number of bytes sent including header
+         */
+        auto writeFrame(WebSocketOpcode p_opcode, bool p_fin, std::span< const uint8_t > p_payload) -> uint64_t {
+            if (m_close_sent) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::WEBSOCKET_CLOSED);
+                return 0;
+            }
+            std::array< uint8_t, 4 > l_key{};
+            const std::array< uint8_t, 4 >* l_key_pointer = nullptr;
+            if (m_role == WebSocketRole::CLIENT) {
+                auto l_random = m_random();
+                for (uint8_t i = 0; i < 4; ++i) {
+                    l_key[i] = static_cast< uint8_t >(l_random >> (i * 8));
+                }
+                l_key_pointer = &l_key;
+            }
+            if (m_send_offset == m_send_buffer.size()) {
+                m_send_buffer.clear();
+                m_send_offset = 0;
+            }
+            auto l_frame_begin = m_send_buffer.size();
+            m_send_buffer.resize(l_frame_begin + WebSocketCodec::max_header_size);
+            auto l_header_size = WebSocketCodec::encodeHeader(p_opcode, p_fin, p_payload.size(), l_key_pointer, m_send_buffer.data() + l_frame_begin);
+            m_send_buffer.resize(l_frame_begin + l_header_size);
+            if (l_key_pointer == nullptr && p_payload.size() > direct_write_threshold && not m_socket.nonBlocking()) {
+                auto l_bytes_sent = WebSocket::flush();
+                if (m_error) {
+                    return l_bytes_sent;
+                }
+                return l_bytes_sent + WebSocket::send(p_payload);
+            }
+            m_send_buffer.resize(l_frame_begin + l_header_size + p_payload.size());
+            if (l_key_pointer != nullptr) {
+                WebSocketCodec::copyMasked(p_payload, m_send_buffer.data() + l_frame_begin + l_header_size, l_key);
+            } else if (not p_payload.empty()) {
+                std::memcpy(m_send_buffer.data() + l_frame_begin + l_header_size, p_payload.data(), p_payload.size());
+            }
+            return WebSocket::flush();
+        }
+
+        /**
+         * \brief Sends queued frames.
+         * In non blocking mode data which was not accepted by socket is kept and sent on next flush
+         * \return uint64_t number of bytes sent
+         */
+        auto flush() -> uint64_t {
+            auto l_bytes_sent = WebSocket::send(std::span< const uint8_t >(m_send_buffer).subspan(m_send_offset));
+            m_send_offset += l_bytes_sent;
+            return l_bytes_sent;
+        }
+
+        /**
+         * \brief Returns number of queued bytes which were not sent yet
+         * \return uint64_t
+         */
+        [[nodiscard]] auto pendingWriteSize() const noexcept -> uint64_t { return m_send_buffer.size() - m_send_offset; }
+
+        /**
+         * \brief Sends ping
+         * \param p_payload std::span< const uint8_t >. Should not exceed 125 bytes
+         * \return uint64_t number of bytes sent including header
+         */
+        auto ping(std::span< const uint8_t > p_payload = {}) -> uint64_t { return WebSocket::writeFrame(WebSocketOpcode::PING, true, p_payload.first(std::min< std::size_t >(p_payload.size(), 125))); }
+
+        /**
+         * \brief Sends close frame if it was not sent yet
+         * \param p_code uint16_t status code. Default is 1000
+         * \param p_reason std::string_view. Truncated to 123 bytes
+         * \return uint64_t number of bytes sent including header
+         */
+        auto close(uint16_t p_code = 1000, std::string_view p_reason = {}) -> uint64_t {
+            if (m_close_sent) {
+                return 0;
+            }
+            uint8_t l_payload[125];
+            l_payload[0] = static_cast< uint8_t >(p_code >> 8);
+            l_payload[1] = static_cast< uint8_t >(p_code);
+            auto l_reason_size = std::min< std::size_t >(p_reason.size(), 123);
+            if (l_reason_size > 0) {
+                std::memcpy(l_payload + 2, p_reason.data(), l_reason_size);
+            }
+            auto l_bytes_sent = WebSocket::writeFrame(WebSocketOpcode::CLOSE, true, {l_payload, l_reason_size + 2});
+            m_close_sent = true;
+            return l_bytes_sent;
+        }
+
+        /**
+         * \brief Returns status code of received close frame
+         * \return uint16_t. 0 if close frame was not received or had no status code
+         */
+        [[nodiscard]] auto closeCode() const noexcept -> uint16_t { return m_close_code; }
+
+        /**
+         * \brief Returns true if close frame was both sent and received
+         * \return bool
+         */
+        [[nodiscard]] auto closed() const noexcept -> bool { return m_close_sent && m_close_received; }
+
+        /**
+         * \brief Returns frame parser
+         * \return const WebSocketParser&
+         */
+        [[nodiscard]] auto parser() const noexcept -> const WebSocketParser& { return m_parser; }
+
+        /**
+         * \brief Returns error
+         * \return std::error_code
+         */
+        [[nodiscard]] auto error() const noexcept -> std::error_code { return m_error; }
+
+    private:
+        static constexpr uint64_t direct_write_threshold = 16 * 1024;
+
+        WebSocketParser m_parser;
+
+        Socket& m_socket;
+
+        std::vector< uint8_t > m_send_buffer;
+        uint64_t m_send_offset;
+
+        std::mt19937 m_random;
+
+        std::error_code m_error;
+
+        uint16_t m_close_code;
+
+        WebSocketRole m_role;
+
+        bool m_close_sent;
+        bool m_close_received;
+
+        auto send(std::span< const uint8_t > p_data) -> uint64_t {
+            uint64_t l_bytes_sent = 0;
+            while (l_bytes_sent < p_data.size()) {
+                m_socket.resetError();
+                auto l_sent = m_socket.write(p_data.subspan(l_bytes_sent));
+                if (l_sent == 0) {
+                    m_error = m_socket.error();
+                    break;
+                }
+                l_bytes_sent += l_sent;
+            }
+            return l_bytes_sent;
+        }
+
+        void handleControl(const WebSocketMessage& p_message) {
+            if (p_message.opcode == WebSocketOpcode::PING) {
+                if (not m_close_sent) {
+                    WebSocket::writeFrame(WebSocketOpcode::PONG, true, p_message.payload);
+                }
+            } else if (p_message.opcode == WebSocketOpcode::CLOSE) {
+                m_close_received = true;
+                if (p_message.payload.size() >= 2) {
+                    m_close_code = static_cast< uint16_t >(p_message.payload[0] << 8 | p_message.payload[1]);
+                }
+                WebSocket::close(m_close_code == 0 ? 1000 : m_close_code);
+            }
+        }
+    };
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_WEBSOCKET_HPP
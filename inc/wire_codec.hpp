@@ -0,0 +1,390 @@
+#ifndef SOCKETS_WIRE_CODEC_HPP
+#define SOCKETS_WIRE_CODEC_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * \brief Describes wire fields of the structure.
+ * Should be used in the namespace of the described structure. Order of the fields defines order on the wire.
+ * Up to 16 fields are supported.
+ * \code
+ * struct Order { uint64_t id; double px; uint32_t qty; };
+ * TRISTAN_WIRE_FIELDS(Order, id, px, qty)
+ * \endcode
+ */
+#define TRISTAN_WIRE_FIELDS(Type, ...)                                                                                                                         \
+    [[maybe_unused]] inline constexpr auto tristanWireFields(const Type*) noexcept {                                                                          \
+        return std::make_tuple(TRISTAN_WIRE_FIELDS_SELECT(__VA_ARGS__, TRISTAN_WIRE_FIELDS_16, TRISTAN_WIRE_FIELDS_15, TRISTAN_WIRE_FIELDS_14,              \
+                                                          TRISTAN_WIRE_FIELDS_13, TRISTAN_WIRE_FIELDS_12, TRISTAN_WIRE_FIELDS_11, TRISTAN_WIRE_FIELDS_10,   \
+                                                          TRISTAN_WIRE_FIELDS_9, TRISTAN_WIRE_FIELDS_8, TRISTAN_WIRE_FIELDS_7, TRISTAN_WIRE_FIELDS_6,       \
+                                                          TRISTAN_WIRE_FIELDS_5, TRISTAN_WIRE_FIELDS_4, TRISTAN_WIRE_FIELDS_3, TRISTAN_WIRE_FIELDS_2,       \
+                                                          TRISTAN_WIRE_FIELDS_1)(Type, __VA_ARGS__));                                                       \
+    }
+
+#define TRISTAN_WIRE_FIELDS_SELECT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, NAME, ...) NAME
+#define TRISTAN_WIRE_FIELDS_1(T, f)       &T::f
+#define TRISTAN_WIRE_FIELDS_2(T, f, ...)  &T::f, TRISTAN_WIRE_FIELDS_1(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_3(T, f, ...)  &T::f, TRISTAN_WIRE_FIELDS_2(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_4(T, f, ...)  &T::f, TRISTAN_WIRE_FIELDS_3(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_5(T, f, ...)  &T::f, TRISTAN_WIRE_FIELDS_4(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_6(T, f, ...)  &T::f, TRISTAN_WIRE_FIELDS_5(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_7(T, f, ...)  &T::f, TRISTAN_WIRE_FIELDS_6(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_8(T, f, ...)  &T::f, TRISTAN_WIRE_FIELDS_7(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_9(T, f, ...)  &T::f, TRISTAN_WIRE_FIELDS_8(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_10(T, f, ...) &T::f, TRISTAN_WIRE_FIELDS_9(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_11(T, f, ...) &T::f, TRISTAN_WIRE_FIELDS_10(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_12(T, f, ...) &T::f, TRISTAN_WIRE_FIELDS_11(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_13(T, f, ...) &T::f, TRISTAN_WIRE_FIELDS_12(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_14(T, f, ...) &T::f, TRISTAN_WIRE_FIELDS_13(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_15(T, f, ...) &T::f, TRISTAN_WIRE_FIELDS_14(T, __VA_ARGS__)
+#define TRISTAN_WIRE_FIELDS_16(T, f, ...) &T::f, TRISTAN_WIRE_FIELDS_15(T, __VA_ARGS__)
+
+namespace tristan::sockets {
+
+    /**
+     * \brief Layout of fields on the wire
+     */
+    enum class WirePacking : uint8_t {
+        /**
+         * \brief Fields follow each other without padding
+         */
+        PACKED,
+        /**
+         * \brief Every field is aligned to its natural alignment as it would be in C struct
+         */
+        ALIGNED
+    };
+
+    /**
+     * \brief Concept for structures described with TRISTAN_WIRE_FIELDS
+     */
+    template < class Type >
+    concept WireDescribed = requires(const Type* p_object) { tristanWireFields(p_object); };
+
+    namespace utility {
+
+        template < class Type > struct IsStdArray : std::false_type { };
+
+        template < class Type, std::size_t Size > struct IsStdArray< std::array< Type, Size > > : std::true_type { };
+
+        template < class Type >
+        concept WireScalar = std::is_arithmetic_v< Type > || std::is_enum_v< Type >;
+
+        template < std::size_t Size > struct UnsignedOfSize;
+
+        template <> struct UnsignedOfSize< 1 > {
+            using type = uint8_t;
+        };
+
+        template <> struct UnsignedOfSize< 2 > {
+            using type = uint16_t;
+        };
+
+        template <> struct UnsignedOfSize< 4 > {
+            using type = uint32_t;
+        };
+
+        template <> struct UnsignedOfSize< 8 > {
+            using type = uint64_t;
+        };
+
+        template < std::unsigned_integral Type > [[nodiscard]] constexpr auto byteSwap(Type p_value) noexcept -> Type {
+            if constexpr (sizeof(Type) == 1) {
+                return p_value;
+            } else if (std::is_constant_evaluated()) {
+                Type l_result = 0;
+                for (std::size_t i = 0; i < sizeof(Type); ++i) {
+                    l_result = static_cast< Type >((l_result << 8) | (p_value & 0xFF));
+                    p_value = static_cast< Type >(p_value >> 8);
+                }
+                return l_result;
+            } else if constexpr (sizeof(Type) == 2) {
+                return __builtin_bswap16(p_value);
+            } else if constexpr (sizeof(Type) == 4) {
+                return __builtin_bswap32(p_value);
+            } else {
+                return __builtin_bswap64(p_value);
+            }
+        }
+
+        template < class Type > [[nodiscard]] consteval auto wireFieldsOf() noexcept { return tristanWireFields(static_cast< const Type* >(nullptr)); }
+
+        template < class MemberPointer > struct MemberType;
+
+        template < class Member, class Owner > struct MemberType< Member Owner::* > {
+            using type = Member;
+        };
+
+        template < class Type, WirePacking Packing > consteval auto wireAlignment() -> std::size_t;
+
+        template < class Type, WirePacking Packing > consteval auto wireSize() -> std::size_t;
+
+        template < class Type, WirePacking Packing > consteval auto fieldAlignment() -> std::size_t {
+            if constexpr (Packing == WirePacking::PACKED) {
+                return 1;
+            } else if constexpr (WireScalar< Type >) {
+                return sizeof(Type);
+            } else if constexpr (IsStdArray< Type >::value) {
+                return fieldAlignment< typename Type::value_type, Packing >();
+            } else {
+                return wireAlignment< Type, Packing >();
+            }
+        }
+
+        template < class Type, WirePacking Packing > consteval auto fieldSize() -> std::size_t {
+            if constexpr (WireScalar< Type >) {
+                static_assert(sizeof(Type) == 1 || sizeof(Type) == 2 || sizeof(Type) == 4 || sizeof(Type) == 8, "Unsupported scalar size");
+                return sizeof(Type);
+            } else if constexpr (IsStdArray< Type >::value) {
+                return std::tuple_size_v< Type > * fieldSize< typename Type::value_type, Packing >();
+            } else {
+                static_assert(WireDescribed< Type >, "Field type should be arithmetic, enum, std::array or described with TRISTAN_WIRE_FIELDS");
+                return wireSize< Type, Packing >();
+            }
+        }
+
+        [[nodiscard]] constexpr auto alignUp(std::size_t p_value, std::size_t p_alignment) noexcept -> std::size_t {
+            return (p_value + p_alignment - 1) / p_alignment * p_alignment;
+        }
+
+        template < class Type, WirePacking Packing > consteval auto wireAlignment() -> std::size_t {
+            return std::apply(
+                [](auto... p_members) {
+                    std::size_t l_alignment = 1;
+                    ((l_alignment = std::max(l_alignment, fieldAlignment< typename MemberType< decltype(p_members) >::type, Packing >())), ...);
+                    return l_alignment;
+                },
+                wireFieldsOf< Type >());
+        }
+
+        template < class Type, WirePacking Packing > consteval auto wireOffsets() {
+            constexpr auto l_fields = wireFieldsOf< Type >();
+            return std::apply(
+                [](auto... p_members) {
+                    std::array< std::size_t, sizeof...(p_members) + 1 > l_offsets{};
+                    std::size_t l_offset = 0;
+                    std::size_t l_index = 0;
+                    ((l_offset = alignUp(l_offset, fieldAlignment< typename MemberType< decltype(p_members) >::type, Packing >()),
+                      l_offsets[l_index++] = l_offset,
+                      l_offset += fieldSize< typename MemberType< decltype(p_members) >::type, Packing >()),
+                     ...);
+                    l_offsets[l_index] = alignUp(l_offset, wireAlignment< Type, Packing >());
+                    return l_offsets;
+                },
+                l_fields);
+        }
+
+        template < class Type, WirePacking Packing > consteval auto wireSize() -> std::size_t {
+            constexpr auto l_offsets = wireOffsets< Type, Packing >();
+            return l_offsets.back();
+        }
+
+        template < class Type, std::endian Order, WirePacking Packing > void encodeField(const Type& p_value, uint8_t* p_destination) noexcept;
+
+        template < class Type, std::endian Order, WirePacking Packing > void decodeField(const uint8_t* p_source, Type& p_value) noexcept;
+
+        template < class Type, std::endian Order, WirePacking Packing > void encodeObject(const Type& p_object, uint8_t* p_destination) noexcept {
+            constexpr auto l_fields = wireFieldsOf< Type >();
+            constexpr auto l_offsets = wireOffsets< Type, Packing >();
+            [&]< std::size_t... Index >(std::index_sequence< Index... >) {
+                (encodeField< typename MemberType< std::tuple_element_t< Index, std::remove_const_t< decltype(l_fields) > > >::type, Order, Packing >(
+                     p_object.*std::get< Index >(l_fields), p_destination + l_offsets[Index]),
+                 ...);
+            }(std::make_index_sequence< std::tuple_size_v< std::remove_const_t< decltype(l_fields) > > >{});
+        }
+
+        template < class Type, std::endian Order, WirePacking Packing > void decodeObject(const uint8_t* p_source, Type& p_object) noexcept {
+            constexpr auto l_fields = wireFieldsOf< Type >();
+            constexpr auto l_offsets = wireOffsets< Type, Packing >();
+            [&]< std::size_t... Index >(std::index_sequence< Index... >) {
+                (decodeField< typename MemberType< std::tuple_element_t< Index, std::remove_const_t< decltype(l_fields) > > >::type, Order, Packing >(
+                     p_source + l_offsets[Index], p_object.*std::get< Index >(l_fields)),
+                 ...);
+            }(std::make_index_sequence< std::tuple_size_v< std::remove_const_t< decltype(l_fields) > > >{});
+        }
+
+        template < class Type, std::endian Order, WirePacking Packing > void encodeField(const Type& p_value, uint8_t* p_destination) noexcept {
+            if constexpr (WireScalar< Type >) {
+                using Bits = typename UnsignedOfSize< sizeof(Type) >::type;
+                Bits l_bits;
+                if constexpr (std::is_enum_v< Type >) {
+                    l_bits = static_cast< Bits >(static_cast< std::underlying_type_t< Type > >(p_value));
+                } else if constexpr (std::is_same_v< Type, bool >) {
+                    l_bits = p_value ? 1 : 0;
+                } else {
+                    l_bits = std::bit_cast< Bits >(p_value);
+                }
+                if constexpr (Order != std::endian::native) {
+                    l_bits = byteSwap(l_bits);
+                }
+                std::memcpy(p_destination, &l_bits, sizeof(Bits));
+            } else if constexpr (IsStdArray< Type >::value) {
+                constexpr auto l_element_size = fieldSize< typename Type::value_type, Packing >();
+                for (std::size_t i = 0; i < p_value.size(); ++i) {
+                    encodeField< typename Type::value_type, Order, Packing >(p_value[i], p_destination + i * l_element_size);
+                }
+            } else {
+                encodeObject< Type, Order, Packing >(p_value, p_destination);
+            }
+        }
+
+        template < class Type, std::endian Order, WirePacking Packing > void decodeField(const uint8_t* p_source, Type& p_value) noexcept {
+            if constexpr (WireScalar< Type >) {
+                using Bits = typename UnsignedOfSize< sizeof(Type) >::type;
+                Bits l_bits;
+                std::memcpy(&l_bits, p_source, sizeof(Bits));
+                if constexpr (Order != std::endian::native) {
+                    l_bits = byteSwap(l_bits);
+                }
+                if constexpr (std::is_enum_v< Type >) {
+                    p_value = static_cast< Type >(static_cast< std::underlying_type_t< Type > >(l_bits));
+                } else if constexpr (std::is_same_v< Type, bool >) {
+                    p_value = l_bits != 0;
+                } else {
+                    p_value = std::bit_cast< Type >(l_bits);
+                }
+            } else if constexpr (IsStdArray< Type >::value) {
+                constexpr auto l_element_size = fieldSize< typename Type::value_type, Packing >();
+                for (std::size_t i = 0; i < p_value.size(); ++i) {
+                    decodeField< typename Type::value_type, Order, Packing >(p_source + i * l_element_size, p_value[i]);
+                }
+            } else {
+                decodeObject< Type, Order, Packing >(p_source, p_value);
+            }
+        }
+
+    }  // namespace utility
+
+    /**
+     * \brief Encodes and decodes structures described with TRISTAN_WIRE_FIELDS to portable binary representation.
+     * Layout is computed at compile time, byte swapping is performed only if Order differs from host order.
+     * \tparam Type Structure described with TRISTAN_WIRE_FIELDS
+     * \tparam Order std::endian. Default is network byte order
+     * \tparam Packing WirePacking. Default is WirePacking::PACKED
+     */
+    template < WireDescribed Type, std::endian Order = std::endian::big, WirePacking Packing = WirePacking::PACKED > struct WireCodec {
+        /**
+         * \brief Size of encoded object in bytes
+         */
+        static constexpr std::size_t size = utility::wireSize< Type, Packing >();
+
+        /**
+         * \brief Encodes object
+         * \param p_object const Type&
+         * \param p_destination uint8_t*. Should point to at least size bytes
+         */
+        static void encode(const Type& p_object, uint8_t* p_destination) noexcept {
+            if constexpr (Packing == WirePacking::ALIGNED) {
+                std::memset(p_destination, 0, size);
+            }
+            utility::encodeObject< Type, Order, Packing >(p_object, p_destination);
+        }
+
+        /**
+         * \brief Decodes object
+         * \param p_source const uint8_t*. Should point to at least size bytes
+         * \param p_object Type&
+         */
+        static void decode(const uint8_t* p_source, Type& p_object) noexcept { utility::decodeObject< Type, Order, Packing >(p_source, p_object); }
+
+        /**
+         * \overload
+         * \brief Encodes array of objects
+         * \param p_objects std::span< const Type >
+         * \param p_destination std::span< uint8_t >
+         * \return std::size_t number of bytes written. Only objects which fit into p_destination completely are encoded
+         */
+        static auto encode(std::span< const Type > p_objects, std::span< uint8_t > p_destination) noexcept -> std::size_t {
+            auto l_count = std::min(p_objects.size(), p_destination.size() / size);
+            auto* l_destination = p_destination.data();
+            for (std::size_t i = 0; i < l_count; ++i) {
+                WireCodec::encode(p_objects[i], l_destination + i * size);
+            }
+            return l_count * size;
+        }
+
+        /**
+         * \overload
+         * \brief Decodes array of objects
+         * \param p_source std::span< const uint8_t >
+         * \param p_objects std::span< Type >
+         * \return std::size_t number of objects decoded
+         */
+        static auto decode(std::span< const uint8_t > p_source, std::span< Type > p_objects) noexcept -> std::size_t {
+            auto l_count = std::min(p_objects.size(), p_source.size() / size);
+            const auto* l_source = p_source.data();
+            for (std::size_t i = 0; i < l_count; ++i) {
+                WireCodec::decode(l_source + i * size, p_objects[i]);
+            }
+            return l_count;
+        }
+    };
+
+    /**
+     * \brief Encodes object and writes it to socket without heap allocation
+     * \tparam Codec WireCodec specialisation
+     * \tparam Socket InetSocket or IpcSocket
+     * \param p_socket Socket&
+     * \param p_object const Type&
+     * \return uint64_t number of bytes sent. On error error of the socket is set respectively
+     */
+    template < class Codec, class Socket, class Type > auto writeWire(Socket& p_socket, const Type& p_object) -> uint64_t {
+        std::array< uint8_t, Codec::size > l_buffer;
+        Codec::encode(p_object, l_buffer.data());
+        return p_socket.write(std::span< const uint8_t, Codec::size >(l_buffer));
+    }
+
+    /**
+     * \overload
+     * \brief Encodes array of objects and writes it to socket in chunks through stack buffer
+     * \tparam Codec WireCodec specialisation
+     * \tparam Socket InetSocket or IpcSocket
+     * \param p_socket Socket&
+     * \param p_objects std::span< const Type >
+     * \return uint64_t number of bytes sent. On error error of the socket is set respectively
+     */
+    template < class Codec, class Socket, class Type > auto writeWire(Socket& p_socket, std::span< const Type > p_objects) -> uint64_t {
+        constexpr std::size_t l_objects_per_chunk = Codec::size >= 4096 ? 1 : 4096 / Codec::size;
+        std::array< uint8_t, l_objects_per_chunk * Codec::size > l_buffer;
+        uint64_t l_bytes_sent = 0;
+        while (not p_objects.empty()) {
+            auto l_chunk = p_objects.first(std::min(p_objects.size(), l_objects_per_chunk));
+            auto l_size = Codec::encode(l_chunk, std::span< uint8_t >(l_buffer));
+            auto l_sent = p_socket.write(std::span< const uint8_t >(l_buffer.data(), l_size));
+            l_bytes_sent += l_sent;
+            if (l_sent != l_size || p_socket.error()) {
+                break;
+            }
+            p_objects = p_objects.subspan(l_chunk.size());
+        }
+        return l_bytes_sent;
+    }
+
+    /**
+     * \brief Reads and decodes object from socket without heap allocation
+     * \tparam Codec WireCodec specialisation
+     * \tparam Socket InetSocket or IpcSocket
+     * \param p_socket Socket&
+     * \param p_object Type&
+     * \return bool. False if object was not read completely, in which case error of the socket is set respectively
+     */
+    template < class Codec, class Socket, class Type > auto readWire(Socket& p_socket, Type& p_object) -> bool {
+        std::array< uint8_t, Codec::size > l_buffer;
+        if (p_socket.readInto(std::span< uint8_t, Codec::size >(l_buffer)) != Codec::size) {
+            return false;
+        }
+        Codec::decode(l_buffer.data(), p_object);
+        return true;
+    }
+
+}  // namespace tristan::sockets
+
+#endif  //SOCKETS_WIRE_CODEC_HPP
@@ -0,0 +1,203 @@
+#include "buffer_autotuner.hpp"
+
+#include <linux/sockios.h>
+#include <linux/tcp.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+    auto readBufferSize(int32_t p_socket, int32_t p_option) -> uint64_t {
+        int32_t l_size = 0;
+        socklen_t l_size_length = sizeof(l_size);
+        if (::getsockopt(p_socket, SOL_SOCKET, p_option, &l_size, &l_size_length) < 0) {
+            return 0;
+        }
+        return static_cast< uint64_t >(l_size);
+    }
+
+    auto queueSize(int32_t p_socket, unsigned long p_request) -> uint64_t {
+        int32_t l_size = 0;
+        if (::ioctl(p_socket, p_request, &l_size) < 0 || l_size < 0) {
+            return 0;
+        }
+        return static_cast< uint64_t >(l_size);
+    }
+
+    auto readTcpInfo(int32_t p_socket, tcp_info& p_info) -> bool {
+        socklen_t l_info_length = sizeof(p_info);
+        return ::getsockopt(p_socket, IPPROTO_TCP, TCP_INFO, &p_info, &l_info_length) == 0;
+    }
+
+    /**
+     * \brief Buffer grows when need exceeds its size by a quarter and shrinks when need is below half of it, so size does not flap between samples
+     */
+    auto significant(uint64_t p_target, uint64_t p_requested) -> bool { return p_target * 4 > p_requested * 5 || p_target * 2 < p_requested; }
+
+}  // namespace
+
+tristan::sockets::BufferAutotuner::BufferAutotuner(uint64_t p_memory_cap, uint32_t p_min_buffer_size, uint32_t p_max_buffer_size) :
+    m_memory_cap(p_memory_cap),
+    m_memory_in_use(0),
+    m_min_buffer_size(p_min_buffer_size),
+    m_max_buffer_size(std::clamp< uint32_t >(p_max_buffer_size, p_min_buffer_size, std::numeric_limits< int32_t >::max())) { }
+
+auto tristan::sockets::BufferAutotuner::tune() -> uint64_t {
+    auto l_now = std::chrono::steady_clock::now();
+    uint64_t l_needed = 0;
+    for (auto& l_connection: m_connections) {
+        BufferAutotuner::sample(l_connection, l_now);
+        // Kernel allocates twice the requested size
+        l_needed += (l_connection.send.target + l_connection.receive.target) * 2;
+    }
+    if (l_needed > m_memory_cap) {
+        // Only the part above minimum size is scaled, so minimum sized buffers still fit into the cap
+        uint64_t l_minimum = m_connections.size() * m_min_buffer_size * 4;
+        auto l_scale = m_memory_cap > l_minimum ? static_cast< double >(m_memory_cap - l_minimum) / static_cast< double >(l_needed - l_minimum) : 0.0;
+        for (auto& l_connection: m_connections) {
+            for (auto* l_buffer: {&l_connection.send, &l_connection.receive}) {
+                l_buffer->target = m_min_buffer_size + static_cast< uint64_t >(static_cast< double >(l_buffer->target - m_min_buffer_size) * l_scale);
+            }
+        }
+    }
+
+    uint64_t l_resized = 0;
+    // Shrinking first releases memory which growing buffers may take within the cap.
+    // Buffers are taken over from kernel autotuning on first call, so they do not grow beyond the cap on their own
+    for (auto& l_connection: m_connections) {
+        for (auto [l_buffer, l_option]: {std::pair{&l_connection.send, SO_SNDBUF}, std::pair{&l_connection.receive, SO_RCVBUF}}) {
+            if (l_buffer->target <= l_buffer->requested && (not l_buffer->managed || significant(l_buffer->target, l_buffer->requested))) {
+                l_resized += BufferAutotuner::resize(l_connection.socket, l_option, *l_buffer) ? 1 : 0;
+            }
+        }
+    }
+    for (auto& l_connection: m_connections) {
+        for (auto [l_buffer, l_option]: {std::pair{&l_connection.send, SO_SNDBUF}, std::pair{&l_connection.receive, SO_RCVBUF}}) {
+            if (l_buffer->target <= l_buffer->requested || (l_buffer->managed && not significant(l_buffer->target, l_buffer->requested))) {
+                continue;
+            }
+            auto l_budget = m_memory_cap > m_memory_in_use ? m_memory_cap - m_memory_in_use : 0;
+            if (l_buffer->target * 2 > l_buffer->allocated + l_budget) {
+                l_buffer->target = std::max((l_buffer->allocated + l_budget) / 2, l_buffer->managed ? l_buffer->requested : 0);
+                if (l_buffer->managed && l_buffer->target <= l_buffer->requested) {
+                    continue;
+                }
+            }
+            l_resized += BufferAutotuner::resize(l_connection.socket, l_option, *l_buffer) ? 1 : 0;
+        }
+    }
+    return l_resized;
+}
+
+auto tristan::sockets::BufferAutotuner::memoryInUse() const noexcept -> uint64_t { return m_memory_in_use; }
+
+auto tristan::sockets::BufferAutotuner::memoryCap() const noexcept -> uint64_t { return m_memory_cap; }
+
+auto tristan::sockets::BufferAutotuner::socketCount() const noexcept -> uint64_t { return m_connections.size(); }
+
+auto tristan::sockets::BufferAutotuner::error() const noexcept -> std::error_code { return m_error; }
+
+void tristan::sockets::BufferAutotuner::addHandle(int32_t p_socket) {
+    if (p_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    auto l_found = std::find_if(m_connections.begin(), m_connections.end(), [p_socket](const Connection& p_connection) { return p_connection.socket == p_socket; });
+    if (l_found != m_connections.end()) {
+        return;
+    }
+    Connection l_connection;
+    l_connection.socket = p_socket;
+    l_connection.send.allocated = readBufferSize(p_socket, SO_SNDBUF);
+    l_connection.send.requested = l_connection.send.allocated / 2;
+    l_connection.receive.allocated = readBufferSize(p_socket, SO_RCVBUF);
+    l_connection.receive.requested = l_connection.receive.allocated / 2;
+    tcp_info l_info{};
+    if (readTcpInfo(p_socket, l_info)) {
+        l_connection.bytes_acked = l_info.tcpi_bytes_acked;
+        l_connection.bytes_received = l_info.tcpi_bytes_received;
+    }
+    l_connection.sampled = std::chrono::steady_clock::now();
+    m_memory_in_use += l_connection.send.allocated + l_connection.receive.allocated;
+    m_connections.push_back(l_connection);
+}
+
+void tristan::sockets::BufferAutotuner::removeHandle(int32_t p_socket) {
+    auto l_found = std::find_if(m_connections.begin(), m_connections.end(), [p_socket](const Connection& p_connection) { return p_connection.socket == p_socket; });
+    if (l_found == m_connections.end()) {
+        return;
+    }
+    m_memory_in_use -= std::min(m_memory_in_use, l_found->send.allocated + l_found->receive.allocated);
+    m_connections.erase(l_found);
+}
+
+void tristan::sockets::BufferAutotuner::sample(Connection& p_connection, std::chrono::steady_clock::time_point p_now) {
+    for (auto [l_buffer, l_option]: {std::pair{&p_connection.send, SO_SNDBUF}, std::pair{&p_connection.receive, SO_RCVBUF}}) {
+        // Kernel changes buffers which are not managed yet
+        if (not l_buffer->managed) {
+            auto l_allocated = readBufferSize(p_connection.socket, l_option);
+            m_memory_in_use = m_memory_in_use - std::min(m_memory_in_use, l_buffer->allocated) + l_allocated;
+            l_buffer->allocated = l_allocated;
+            l_buffer->requested = l_allocated / 2;
+        }
+    }
+    // Target is kept within limits even if the connection is not sampled, tune() relies on it being at least minimum size
+    p_connection.send.target = std::clamp< uint64_t >(p_connection.send.requested, m_min_buffer_size, m_max_buffer_size);
+    p_connection.receive.target = std::clamp< uint64_t >(p_connection.receive.requested, m_min_buffer_size, m_max_buffer_size);
+    std::chrono::duration< double > l_elapsed = p_now - p_connection.sampled;
+    if (l_elapsed.count() <= 0) {
+        return;
+    }
+    p_connection.sampled = p_now;
+
+    auto l_send_queue = queueSize(p_connection.socket, SIOCOUTQ);
+    auto l_receive_queue = queueSize(p_connection.socket, SIOCINQ);
+    tcp_info l_info{};
+    if (readTcpInfo(p_connection.socket, l_info)) {
+        auto l_send_rate = static_cast< double >(l_info.tcpi_bytes_acked - p_connection.bytes_acked) / l_elapsed.count();
+        auto l_receive_rate = static_cast< double >(l_info.tcpi_bytes_received - p_connection.bytes_received) / l_elapsed.count();
+        p_connection.bytes_acked = l_info.tcpi_bytes_acked;
+        p_connection.bytes_received = l_info.tcpi_bytes_received;
+        // Delivery rate is kept by kernel while connection is idle, so it is only trusted when data was acknowledged during the interval
+        if (l_send_rate > 0) {
+            l_send_rate = std::max(l_send_rate, static_cast< double >(l_info.tcpi_delivery_rate));
+        }
+        auto l_round_trip_time = static_cast< double >(l_info.tcpi_rtt) / 1'000'000;
+        auto l_receive_round_trip_time = l_info.tcpi_rcv_rtt > 0 ? static_cast< double >(l_info.tcpi_rcv_rtt) / 1'000'000 : l_round_trip_time;
+        p_connection.send.target = static_cast< uint64_t >(2 * l_send_rate * l_round_trip_time);
+        p_connection.receive.target = static_cast< uint64_t >(2 * l_receive_rate * l_receive_round_trip_time);
+        if (l_send_queue * 4 >= p_connection.send.requested * 3) {
+            p_connection.send.target = std::max(p_connection.send.target, p_connection.send.requested * 2);
+        }
+        if (l_receive_queue * 4 >= p_connection.receive.requested * 3) {
+            p_connection.receive.target = std::max(p_connection.receive.target, p_connection.receive.requested * 2);
+        }
+    } else {
+        // Without TCP_INFO only send queue occupancy is known, which includes bookkeeping overhead for local sockets
+        if (l_send_queue * 4 >= p_connection.send.allocated * 3) {
+            p_connection.send.target = p_connection.send.requested * 2;
+        } else if (l_send_queue == 0 && l_receive_queue == 0) {
+            p_connection.send.target = m_min_buffer_size;
+        }
+    }
+    p_connection.send.target = std::clamp< uint64_t >(std::max(p_connection.send.target, l_send_queue), m_min_buffer_size, m_max_buffer_size);
+    p_connection.receive.target = std::clamp< uint64_t >(std::max(p_connection.receive.target, l_receive_queue), m_min_buffer_size, m_max_buffer_size);
+}
+
+auto tristan::sockets::BufferAutotuner::resize(int32_t p_socket, int32_t p_option, Buffer& p_buffer) -> bool {
+    auto l_size = static_cast< int32_t >(p_buffer.target);
+    if (::setsockopt(p_socket, SOL_SOCKET, p_option, &l_size, sizeof(l_size)) < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+        return false;
+    }
+    auto l_allocated = readBufferSize(p_socket, p_option);
+    m_memory_in_use = m_memory_in_use - std::min(m_memory_in_use, p_buffer.allocated) + l_allocated;
+    p_buffer.allocated = l_allocated;
+    p_buffer.requested = p_buffer.target;
+    p_buffer.managed = true;
+    return true;
+}
@@ -0,0 +1,284 @@
+#include "compressor.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#if defined(TRISTAN_SOCKETS_WITH_LZ4)
+  #include <lz4.h>
+#endif
+#if defined(TRISTAN_SOCKETS_WITH_ZSTD)
+  #include <zstd.h>
+#endif
+#if defined(TRISTAN_SOCKETS_WITH_ZLIB)
+  #include <zlib.h>
+#endif
+
+namespace {
+
+#if defined(TRISTAN_SOCKETS_WITH_LZ4)
+    class Lz4Compressor final : public tristan::sockets::Compressor {
+    public:
+        Lz4Compressor(int32_t p_level, std::span< const uint8_t > p_dictionary) :
+            m_dictionary(p_dictionary.begin(), p_dictionary.end()),
+            m_stream(LZ4_createStream()),
+            m_acceleration(p_level <= 0 ? 1 : p_level) { }
+
+        ~Lz4Compressor() override { LZ4_freeStream(m_stream); }
+
+        [[nodiscard]] auto ready() const noexcept -> bool { return m_stream != nullptr; }
+
+        [[nodiscard]] auto algorithm() const noexcept -> tristan::sockets::CompressionAlgorithm override { return tristan::sockets::CompressionAlgorithm::LZ4; }
+
+        [[nodiscard]] auto bound(uint64_t p_size) const noexcept -> uint64_t override {
+            if (p_size > LZ4_MAX_INPUT_SIZE) {
+                return 0;
+            }
+            return static_cast< uint64_t >(LZ4_compressBound(static_cast< int >(p_size)));
+        }
+
+        [[nodiscard]] auto compress(std::span< const uint8_t > p_source, std::span< uint8_t > p_destination) -> uint64_t override {
+            if (p_source.size() > LZ4_MAX_INPUT_SIZE) {
+                return 0;
+            }
+            auto l_capacity = static_cast< int >(std::min< uint64_t >(p_destination.size(), std::numeric_limits< int >::max()));
+            LZ4_resetStream_fast(m_stream);
+            if (not m_dictionary.empty()) {
+                LZ4_loadDict(m_stream, reinterpret_cast< const char* >(m_dictionary.data()), static_cast< int >(m_dictionary.size()));
+            }
+            auto l_size = LZ4_compress_fast_continue(m_stream,
+                                                     reinterpret_cast< const char* >(p_source.data()),
+                                                     reinterpret_cast< char* >(p_destination.data()),
+                                                     static_cast< int >(p_source.size()),
+                                                     l_capacity,
+                                                     m_acceleration);
+            return l_size > 0 ? static_cast< uint64_t >(l_size) : 0;
+        }
+
+        [[nodiscard]] auto decompress(std::span< const uint8_t > p_source, std::span< uint8_t > p_destination) -> bool override {
+            if (p_source.size() > static_cast< uint64_t >(std::numeric_limits< int >::max()) || p_destination.size() > LZ4_MAX_INPUT_SIZE) {
+                return false;
+            }
+            auto l_size = LZ4_decompress_safe_usingDict(reinterpret_cast< const char* >(p_source.data()),
+                                                        reinterpret_cast< char* >(p_destination.data()),
+                                                        static_cast< int >(p_source.size()),
+                                                        static_cast< int >(p_destination.size()),
+                                                        reinterpret_cast< const char* >(m_dictionary.data()),
+                                                        static_cast< int >(m_dictionary.size()));
+            return l_size >= 0 && static_cast< uint64_t >(l_size) == p_destination.size();
+        }
+
+    private:
+        std::vector< uint8_t > m_dictionary;
+        LZ4_stream_t* m_stream;
+        int m_acceleration;
+    };
+#endif
+
+#if defined(TRISTAN_SOCKETS_WITH_ZSTD)
+    class ZstdCompressor final : public tristan::sockets::Compressor {
+    public:
+        ZstdCompressor(int32_t p_level, std::span< const uint8_t > p_dictionary) :
+            m_compression_context(ZSTD_createCCtx()),
+            m_decompression_context(ZSTD_createDCtx()),
+            m_compression_dictionary(nullptr),
+            m_decompression_dictionary(nullptr),
+            m_level(p_level == 0 ? ZSTD_CLEVEL_DEFAULT : p_level),
+            m_dictionary_requested(not p_dictionary.empty()) {
+            if (not p_dictionary.empty()) {
+                m_compression_dictionary = ZSTD_createCDict(p_dictionary.data(), p_dictionary.size(), m_level);
+                m_decompression_dictionary = ZSTD_createDDict(p_dictionary.data(), p_dictionary.size());
+            }
+        }
+
+        ~ZstdCompressor() override {
+            ZSTD_freeCDict(m_compression_dictionary);
+            ZSTD_freeDDict(m_decompression_dictionary);
+            ZSTD_freeCCtx(m_compression_context);
+            ZSTD_freeDCtx(m_decompression_context);
+        }
+
+        [[nodiscard]] auto ready() const noexcept -> bool {
+            return m_compression_context != nullptr && m_decompression_context != nullptr
+                && (not m_dictionary_requested || (m_compression_dictionary != nullptr && m_decompression_dictionary != nullptr));
+        }
+
+        [[nodiscard]] auto algorithm() const noexcept -> tristan::sockets::CompressionAlgorithm override { return tristan::sockets::CompressionAlgorithm::ZSTD; }
+
+        [[nodiscard]] auto bound(uint64_t p_size) const noexcept -> uint64_t override { return ZSTD_compressBound(p_size); }
+
+        [[nodiscard]] auto compress(std::span< const uint8_t > p_source, std::span< uint8_t > p_destination) -> uint64_t override {
+            std::size_t l_size;
+            if (m_compression_dictionary != nullptr) {
+                l_size = ZSTD_compress_usingCDict(
+                    m_compression_context, p_destination.data(), p_destination.size(), p_source.data(), p_source.size(), m_compression_dictionary);
+            } else {
+                l_size = ZSTD_compressCCtx(m_compression_context, p_destination.data(), p_destination.size(), p_source.data(), p_source.size(), m_level);
+            }
+            return ZSTD_isError(l_size) != 0 ? 0 : l_size;
+        }
+
+        [[nodiscard]] auto decompress(std::span< const uint8_t > p_source, std::span< uint8_t > p_destination) -> bool override {
+            std::size_t l_size;
+            if (m_decompression_dictionary != nullptr) {
+                l_size = ZSTD_decompress_usingDDict(
+                    m_decompression_context, p_destination.data(), p_destination.size(), p_source.data(), p_source.size(), m_decompression_dictionary);
+            } else {
+                l_size = ZSTD_decompressDCtx(m_decompression_context, p_destination.data(), p_destination.size(), p_source.data(), p_source.size());
+            }
+            return ZSTD_isError(l_size) == 0 && l_size == p_destination.size();
+        }
+
+    private:
+        ZSTD_CCtx* m_compression_context;
+        ZSTD_DCtx* m_decompression_context;
+        ZSTD_CDict* m_compression_dictionary;
+        ZSTD_DDict* m_decompression_dictionary;
+        int m_level;
+        bool m_dictionary_requested;
+    };
+#endif
+
+#if defined(TRISTAN_SOCKETS_WITH_ZLIB)
+    class ZlibCompressor final : public tristan::sockets::Compressor {
+    public:
+        ZlibCompressor(int32_t p_level, std::span< const uint8_t > p_dictionary) :
+            m_dictionary(p_dictionary.begin(), p_dictionary.end()),
+            m_deflate{},
+            m_inflate{} {
+            m_deflate_ready = deflateInit2(&m_deflate, p_level == 0 ? Z_DEFAULT_COMPRESSION : p_level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+            m_inflate_ready = inflateInit2(&m_inflate, -15) == Z_OK;
+        }
+
+        ~ZlibCompressor() override {
+            if (m_deflate_ready) {
+                deflateEnd(&m_deflate);
+            }
+            if (m_inflate_ready) {
+                inflateEnd(&m_inflate);
+            }
+        }
+
+        [[nodiscard]] auto ready() const noexcept -> bool { return m_deflate_ready && m_inflate_ready; }
+
+        [[nodiscard]] auto algorithm() const noexcept -> tristan::sockets::CompressionAlgorithm override { return tristan::sockets::CompressionAlgorithm::ZLIB; }
+
+        [[nodiscard]] auto bound(uint64_t p_size) const noexcept -> uint64_t override {
+            if (p_size > std::numeric_limits< uInt >::max()) {
+                return 0;
+            }
+            return deflateBound(const_cast< z_stream* >(&m_deflate), static_cast< uLong >(p_size));
+        }
+
+        [[nodiscard]] auto compress(std::span< const uint8_t > p_source, std::span< uint8_t > p_destination) -> uint64_t override {
+            if (p_source.size() > std::numeric_limits< uInt >::max()) {
+                return 0;
+            }
+            deflateReset(&m_deflate);
+            if (not m_dictionary.empty()) {
+                deflateSetDictionary(&m_deflate, m_dictionary.data(), static_cast< uInt >(m_dictionary.size()));
+            }
+            m_deflate.next_in = const_cast< Bytef* >(p_source.data());
+            m_deflate.avail_in = static_cast< uInt >(p_source.size());
+            m_deflate.next_out = p_destination.data();
+            m_deflate.avail_out = static_cast< uInt >(std::min< uint64_t >(p_destination.size(), std::numeric_limits< uInt >::max()));
+            if (deflate(&m_deflate, Z_FINISH) != Z_STREAM_END) {
+                return 0;
+            }
+            return m_deflate.total_out;
+        }
+
+        [[nodiscard]] auto decompress(std::span< const uint8_t > p_source, std::span< uint8_t > p_destination) -> bool override {
+            if (p_source.size() > std::numeric_limits< uInt >::max() || p_destination.size() > std::numeric_limits< uInt >::max()) {
+                return false;
+            }
+            inflateReset(&m_inflate);
+            if (not m_dictionary.empty()) {
+                inflateSetDictionary(&m_inflate, m_dictionary.data(), static_cast< uInt >(m_dictionary.size()));
+            }
+            m_inflate.next_in = const_cast< Bytef* >(p_source.data());
+            m_inflate.avail_in = static_cast< uInt >(p_source.size());
+            m_inflate.next_out = p_destination.data();
+            m_inflate.avail_out = static_cast< uInt >(p_destination.size());
+            return inflate(&m_inflate, Z_FINISH) == Z_STREAM_END && m_inflate.total_out == p_destination.size();
+        }
+
+    private:
+        std::vector< uint8_t > m_dictionary;
+        z_stream m_deflate;
+        z_stream m_inflate;
+        bool m_deflate_ready;
+        bool m_inflate_ready;
+    };
+#endif
+
+    template < class Implementation > auto makeReady(int32_t p_level, std::span< const uint8_t > p_dictionary) -> std::unique_ptr< tristan::sockets::Compressor > {
+        auto l_compressor = std::make_unique< Implementation >(p_level, p_dictionary);
+        if (not l_compressor->ready()) {
+            return nullptr;
+        }
+        return l_compressor;
+    }
+
+}  // namespace
+
+auto tristan::sockets::Compressor::create(CompressionAlgorithm p_algorithm, [[maybe_unused]] int32_t p_level, [[maybe_unused]] std::span< const uint8_t > p_dictionary)
+    -> std::unique_ptr< Compressor > {
+    switch (p_algorithm) {
+        case CompressionAlgorithm::LZ4: {
+#if defined(TRISTAN_SOCKETS_WITH_LZ4)
+            return makeReady< Lz4Compressor >(p_level, p_dictionary);
+#else
+            break;
+#endif
+        }
+        case CompressionAlgorithm::ZSTD: {
+#if defined(TRISTAN_SOCKETS_WITH_ZSTD)
+            return makeReady< ZstdCompressor >(p_level, p_dictionary);
+#else
+            break;
+#endif
+        }
+        case CompressionAlgorithm::ZLIB: {
+#if defined(TRISTAN_SOCKETS_WITH_ZLIB)
+            return makeReady< ZlibCompressor >(p_level, p_dictionary);
+#else
+            break;
+#endif
+        }
+        case CompressionAlgorithm::NONE: {
+            break;
+        }
+    }
+    return nullptr;
+}
+
+auto tristan::sockets::Compressor::supported(CompressionAlgorithm p_algorithm) noexcept -> bool {
+    switch (p_algorithm) {
+        case CompressionAlgorithm::LZ4: {
+#if defined(TRISTAN_SOCKETS_WITH_LZ4)
+            return true;
+#else
+            return false;
+#endif
+        }
+        case CompressionAlgorithm::ZSTD: {
+#if defined(TRISTAN_SOCKETS_WITH_ZSTD)
+            return true;
+#else
+            return false;
+#endif
+        }
+        case CompressionAlgorithm::ZLIB: {
+#if defined(TRISTAN_SOCKETS_WITH_ZLIB)
+            return true;
+#else
+            return false;
+#endif
+        }
+        case CompressionAlgorithm::NONE: {
+            return false;
+        }
+    }
+    return false;
+}
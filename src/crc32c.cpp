@@ -0,0 +1,168 @@
+#include "crc32c.hpp"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__)
+  #include <immintrin.h>
+#endif
+
+namespace {
+
+    constexpr uint32_t g_polynomial = 0x82F63B78;
+
+    constexpr auto makeTables() -> std::array< std::array< uint32_t, 256 >, 8 > {
+        std::array< std::array< uint32_t, 256 >, 8 > l_tables{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t l_crc = i;
+            for (uint8_t j = 0; j < 8; ++j) {
+                l_crc = (l_crc >> 1) ^ ((l_crc & 1) != 0 ? g_polynomial : 0);
+            }
+            l_tables[0][i] = l_crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i) {
+            for (uint8_t k = 1; k < 8; ++k) {
+                l_tables[k][i] = (l_tables[k - 1][i] >> 8) ^ l_tables[0][l_tables[k - 1][i] & 0xFF];
+            }
+        }
+        return l_tables;
+    }
+
+    constexpr auto g_tables = makeTables();
+
+    [[nodiscard]] auto loadLittleEndian(const uint8_t* p_data) noexcept -> uint64_t {
+        uint64_t l_value = 0;
+        for (uint8_t i = 0; i < 8; ++i) {
+            l_value |= static_cast< uint64_t >(p_data[i]) << (i * 8);
+        }
+        return l_value;
+    }
+
+    [[nodiscard]] auto softwareCrc(const uint8_t* p_source, uint8_t* p_destination, uint64_t p_size, uint32_t p_crc) noexcept -> uint32_t {
+        uint64_t l_index = 0;
+        for (; l_index + 8 <= p_size; l_index += 8) {
+            auto l_word = loadLittleEndian(p_source + l_index);
+            if (p_destination != nullptr) {
+                std::memcpy(p_destination + l_index, p_source + l_index, 8);
+            }
+            auto l_low = static_cast< uint32_t >(l_word) ^ p_crc;
+            auto l_high = static_cast< uint32_t >(l_word >> 32);
+            p_crc = g_tables[7][l_low & 0xFF] ^ g_tables[6][(l_low >> 8) & 0xFF] ^ g_tables[5][(l_low >> 16) & 0xFF] ^ g_tables[4][l_low >> 24]
+                  ^ g_tables[3][l_high & 0xFF] ^ g_tables[2][(l_high >> 8) & 0xFF] ^ g_tables[1][(l_high >> 16) & 0xFF] ^ g_tables[0][l_high >> 24];
+        }
+        for (; l_index < p_size; ++l_index) {
+            if (p_destination != nullptr) {
+                p_destination[l_index] = p_source[l_index];
+            }
+            p_crc = (p_crc >> 8) ^ g_tables[0][(p_crc ^ p_source[l_index]) & 0xFF];
+        }
+        return p_crc;
+    }
+
+#if defined(__x86_64__)
+    /**
+     * Size of each of three blocks which are processed in parallel to hide latency of crc32 instruction
+     */
+    constexpr uint64_t g_block_size = 512;
+
+    using ShiftTables = std::array< std::array< uint32_t, 256 >, 4 >;
+
+    /**
+     * Returns tables which advance CRC state over g_block_size zero bytes
+     */
+    [[nodiscard]] auto shiftTables() -> const ShiftTables& {
+        static const ShiftTables l_shift_tables = [] {
+            std::array< uint8_t, g_block_size > l_zeros{};
+            std::array< uint32_t, 32 > l_basis{};
+            for (uint8_t i = 0; i < 32; ++i) {
+                l_basis[i] = softwareCrc(l_zeros.data(), nullptr, g_block_size, uint32_t{1} << i);
+            }
+            ShiftTables l_tables{};
+            for (uint8_t k = 0; k < 4; ++k) {
+                for (uint32_t v = 0; v < 256; ++v) {
+                    uint32_t l_value = 0;
+                    for (uint8_t b = 0; b < 8; ++b) {
+                        if ((v >> b & 1) != 0) {
+                            l_value ^= l_basis[k * 8 + b];
+                        }
+                    }
+                    l_tables[k][v] = l_value;
+                }
+            }
+            return l_tables;
+        }();
+        return l_shift_tables;
+    }
+
+    [[nodiscard]] auto shiftBlock(const ShiftTables& p_tables, uint32_t p_crc) noexcept -> uint32_t {
+        return p_tables[0][p_crc & 0xFF] ^ p_tables[1][(p_crc >> 8) & 0xFF] ^ p_tables[2][(p_crc >> 16) & 0xFF] ^ p_tables[3][p_crc >> 24];
+    }
+
+    __attribute__((target("sse4.2"))) auto hardwareCrc(const uint8_t* p_source, uint8_t* p_destination, uint64_t p_size, uint32_t p_crc) noexcept -> uint32_t {
+        uint64_t l_crc = p_crc;
+        uint64_t l_index = 0;
+        const ShiftTables* l_shift_tables = p_size >= 3 * g_block_size ? &shiftTables() : nullptr;
+        for (; l_index + 3 * g_block_size <= p_size; l_index += 3 * g_block_size) {
+            uint64_t l_crc_1 = 0;
+            uint64_t l_crc_2 = 0;
+            for (uint64_t l_offset = l_index; l_offset < l_index + g_block_size; l_offset += 8) {
+                uint64_t l_words[3];
+                std::memcpy(&l_words[0], p_source + l_offset, 8);
+                std::memcpy(&l_words[1], p_source + l_offset + g_block_size, 8);
+                std::memcpy(&l_words[2], p_source + l_offset + 2 * g_block_size, 8);
+                if (p_destination != nullptr) {
+                    std::memcpy(p_destination + l_offset, &l_words[0], 8);
+                    std::memcpy(p_destination + l_offset + g_block_size, &l_words[1], 8);
+                    std::memcpy(p_destination + l_offset + 2 * g_block_size, &l_words[2], 8);
+                }
+                l_crc = _mm_crc32_u64(l_crc, l_words[0]);
+                l_crc_1 = _mm_crc32_u64(l_crc_1, l_words[1]);
+                l_crc_2 = _mm_crc32_u64(l_crc_2, l_words[2]);
+            }
+            l_crc = shiftBlock(*l_shift_tables, shiftBlock(*l_shift_tables, static_cast< uint32_t >(l_crc)) ^ static_cast< uint32_t >(l_crc_1))
+                  ^ static_cast< uint32_t >(l_crc_2);
+        }
+        for (; l_index + 8 <= p_size; l_index += 8) {
+            uint64_t l_word;
+            std::memcpy(&l_word, p_source + l_index, sizeof(l_word));
+            if (p_destination != nullptr) {
+                std::memcpy(p_destination + l_index, &l_word, sizeof(l_word));
+            }
+            l_crc = _mm_crc32_u64(l_crc, l_word);
+        }
+        auto l_crc_32 = static_cast< uint32_t >(l_crc);
+        for (; l_index < p_size; ++l_index) {
+            if (p_destination != nullptr) {
+                p_destination[l_index] = p_source[l_index];
+            }
+            l_crc_32 = _mm_crc32_u8(l_crc_32, p_source[l_index]);
+        }
+        return l_crc_32;
+    }
+
+    [[nodiscard]] auto hardwareSupported() noexcept -> bool {
+        static const bool l_supported = [] {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse4.2") != 0;
+        }();
+        return l_supported;
+    }
+#endif
+
+    [[nodiscard]] auto calculate(const uint8_t* p_source, uint8_t* p_destination, uint64_t p_size, uint32_t p_crc) noexcept -> uint32_t {
+        p_crc = ~p_crc;
+#if defined(__x86_64__)
+        if (hardwareSupported()) {
+            return ~hardwareCrc(p_source, p_destination, p_size, p_crc);
+        }
+#endif
+        return ~softwareCrc(p_source, p_destination, p_size, p_crc);
+    }
+
+}  // namespace
+
+auto tristan::sockets::crc32c(std::span< const uint8_t > p_data, uint32_t p_crc) noexcept -> uint32_t { return calculate(p_data.data(), nullptr, p_data.size(), p_crc); }
+
+auto tristan::sockets::copyCrc32c(std::span< const uint8_t > p_source, uint8_t* p_destination, uint32_t p_crc) noexcept -> uint32_t {
+    return calculate(p_source.data(), p_destination, p_source.size(), p_crc);
+}
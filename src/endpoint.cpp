@@ -0,0 +1,78 @@
+#include "endpoint.hpp"
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <cstddef>
+#include <cstring>
+
+static_assert(sizeof(sockaddr_storage) <= 128, "Endpoint storage is too small");
+
+tristan::sockets::Endpoint::Endpoint() noexcept :
+    m_address{},
+    m_length(0) { }
+
+auto tristan::sockets::Endpoint::inet(uint32_t p_ip, uint16_t p_port) noexcept -> Endpoint {
+    Endpoint l_endpoint;
+    auto* l_address = reinterpret_cast< sockaddr_in* >(l_endpoint.m_address.data());
+    l_address->sin_family = AF_INET;
+    l_address->sin_addr.s_addr = p_ip;
+    l_address->sin_port = p_port;
+    l_endpoint.m_length = sizeof(sockaddr_in);
+    return l_endpoint;
+}
+
+auto tristan::sockets::Endpoint::ipc(std::string_view p_name, bool p_global_namespace) noexcept -> Endpoint {
+    Endpoint l_endpoint;
+    auto* l_address = reinterpret_cast< sockaddr_un* >(l_endpoint.m_address.data());
+    // Abstract name takes leading zero byte, path name may fill whole sun_path without terminating zero
+    auto l_offset = p_global_namespace ? 1 : 0;
+    if (p_name.empty() || p_name.size() + l_offset > sizeof(l_address->sun_path)) {
+        return l_endpoint;
+    }
+    l_address->sun_family = AF_UNIX;
+    std::memcpy(l_address->sun_path + l_offset, p_name.data(), p_name.size());
+    l_endpoint.m_length = static_cast< uint32_t >(offsetof(sockaddr_un, sun_path) + l_offset + p_name.size());
+    return l_endpoint;
+}
+
+auto tristan::sockets::Endpoint::address() const noexcept -> const sockaddr* { return reinterpret_cast< const sockaddr* >(m_address.data()); }
+
+auto tristan::sockets::Endpoint::length() const noexcept -> uint32_t { return m_length; }
+
+auto tristan::sockets::Endpoint::empty() const noexcept -> bool { return m_length == 0; }
+
+auto tristan::sockets::Endpoint::ip() const noexcept -> uint32_t {
+    if (m_length < sizeof(sockaddr_in) || Endpoint::address()->sa_family != AF_INET) {
+        return 0;
+    }
+    return reinterpret_cast< const sockaddr_in* >(m_address.data())->sin_addr.s_addr;
+}
+
+auto tristan::sockets::Endpoint::port() const noexcept -> uint16_t {
+    if (m_length < sizeof(sockaddr_in) || Endpoint::address()->sa_family != AF_INET) {
+        return 0;
+    }
+    return reinterpret_cast< const sockaddr_in* >(m_address.data())->sin_port;
+}
+
+auto tristan::sockets::Endpoint::name() const noexcept -> std::string_view {
+    if (m_length <= offsetof(sockaddr_un, sun_path) || Endpoint::address()->sa_family != AF_UNIX) {
+        return {};
+    }
+    const auto* l_path = reinterpret_cast< const sockaddr_un* >(m_address.data())->sun_path;
+    auto l_path_length = m_length - offsetof(sockaddr_un, sun_path);
+    if (l_path[0] == 0) {
+        return {l_path + 1, l_path_length - 1};
+    }
+    return {l_path, strnlen(l_path, l_path_length)};
+}
+
+auto tristan::sockets::Endpoint::globalNamespace() const noexcept -> bool {
+    return m_length > offsetof(sockaddr_un, sun_path) && Endpoint::address()->sa_family == AF_UNIX
+           && reinterpret_cast< const sockaddr_un* >(m_address.data())->sun_path[0] == 0;
+}
+
+auto tristan::sockets::Endpoint::operator==(const Endpoint& p_other) const noexcept -> bool {
+    return m_length == p_other.m_length && std::memcmp(m_address.data(), p_other.m_address.data(), m_length) == 0;
+}
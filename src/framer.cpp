@@ -0,0 +1,176 @@
+#include "framer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+    struct DecodedPrefix {
+        uint64_t size;
+        uint8_t prefix_size;
+        bool malformed;
+    };
+
+    auto decodePrefix(tristan::sockets::FramePrefix p_prefix, const uint8_t* p_data, uint64_t p_size) -> DecodedPrefix {
+        uint8_t l_prefix_size = 0;
+        switch (p_prefix) {
+            case tristan::sockets::FramePrefix::FIXED_8: {
+                l_prefix_size = 1;
+                break;
+            }
+            case tristan::sockets::FramePrefix::FIXED_16: {
+                l_prefix_size = 2;
+                break;
+            }
+            case tristan::sockets::FramePrefix::FIXED_32: {
+                l_prefix_size = 4;
+                break;
+            }
+            case tristan::sockets::FramePrefix::FIXED_64: {
+                l_prefix_size = 8;
+                break;
+            }
+            case tristan::sockets::FramePrefix::VARINT: {
+                uint64_t l_value = 0;
+                for (uint8_t i = 0; i < p_size && i < tristan::sockets::FrameParser::max_prefix_size; ++i) {
+                    l_value |= static_cast< uint64_t >(p_data[i] & 0x7F) << (7 * i);
+                    if ((p_data[i] & 0x80) == 0) {
+                        return {l_value, static_cast< uint8_t >(i + 1), false};
+                    }
+                }
+                return {0, 0, p_size >= tristan::sockets::FrameParser::max_prefix_size};
+            }
+        }
+        if (p_size < l_prefix_size) {
+            return {0, 0, false};
+        }
+        uint64_t l_value = 0;
+        for (uint8_t i = 0; i < l_prefix_size; ++i) {
+            l_value = (l_value << 8) | p_data[i];
+        }
+        return {l_value, l_prefix_size, false};
+    }
+
+}  // namespace
+
+tristan::sockets::FrameParser::FrameParser(FramePrefix p_prefix, uint64_t p_max_frame_size, uint64_t p_buffer_size, FrameIntegrity p_integrity) :
+    m_buffer(p_buffer_size),
+    m_max_frame_size(p_max_frame_size),
+    m_begin(0),
+    m_end(0),
+    m_pending_frame_size(0),
+    m_prefix(p_prefix),
+    m_integrity(p_integrity) { }
+
+auto tristan::sockets::FrameParser::receiveSpace() -> std::span< uint8_t > {
+    m_frames.clear();
+    if (m_begin > 0) {
+        if (m_end > m_begin) {
+            std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+        }
+        m_end -= m_begin;
+        m_begin = 0;
+    }
+    if (m_pending_frame_size > m_buffer.size()) {
+        m_buffer.resize(m_pending_frame_size);
+    } else if (m_end == m_buffer.size()) {
+        m_buffer.resize(m_buffer.empty() ? max_prefix_size : m_buffer.size() * 2);
+    }
+    return {m_buffer.data() + m_end, m_buffer.size() - m_end};
+}
+
+void tristan::sockets::FrameParser::commit(uint64_t p_size) { m_end += std::min< uint64_t >(p_size, m_buffer.size() - m_end); }
+
+auto tristan::sockets::FrameParser::frames() -> std::span< const std::span< const uint8_t > > {
+    m_pending_frame_size = 0;
+    while (not m_error && m_begin < m_end) {
+        auto l_available = m_end - m_begin;
+        auto l_prefix = decodePrefix(m_prefix, m_buffer.data() + m_begin, l_available);
+        if (l_prefix.malformed) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::FRAME_MALFORMED_PREFIX);
+            break;
+        }
+        if (l_prefix.prefix_size == 0) {
+            break;
+        }
+        uint64_t l_trailer_size = m_integrity == FrameIntegrity::CRC32C ? checksum_size : 0;
+        if (l_prefix.size < l_trailer_size) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::FRAME_MALFORMED_PREFIX);
+            break;
+        }
+        auto l_payload_size = l_prefix.size - l_trailer_size;
+        if (l_payload_size > m_max_frame_size) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::FRAME_TOO_LARGE);
+            break;
+        }
+        auto l_frame_size = l_prefix.prefix_size + l_prefix.size;
+        if (l_frame_size > l_available) {
+            m_pending_frame_size = l_frame_size;
+            break;
+        }
+        std::span< const uint8_t > l_payload(m_buffer.data() + m_begin + l_prefix.prefix_size, l_payload_size);
+        if (l_trailer_size > 0) {
+            uint32_t l_expected = 0;
+            for (uint8_t i = 0; i < checksum_size; ++i) {
+                l_expected = (l_expected << 8) | l_payload.data()[l_payload_size + i];
+            }
+            if (tristan::sockets::crc32c(l_payload) != l_expected) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::FRAME_CHECKSUM_MISMATCH);
+                break;
+            }
+        }
+        m_frames.push_back(l_payload);
+        m_begin += l_frame_size;
+    }
+    return m_frames;
+}
+
+auto tristan::sockets::FrameParser::pendingFrameSize() const noexcept -> uint64_t { return m_pending_frame_size; }
+
+auto tristan::sockets::FrameParser::bufferedSize() const noexcept -> uint64_t { return m_end - m_begin; }
+
+auto tristan::sockets::FrameParser::prefix() const noexcept -> FramePrefix { return m_prefix; }
+
+auto tristan::sockets::FrameParser::maxFrameSize() const noexcept -> uint64_t { return m_max_frame_size; }
+
+auto tristan::sockets::FrameParser::integrity() const noexcept -> FrameIntegrity { return m_integrity; }
+
+auto tristan::sockets::FrameParser::error() const noexcept -> std::error_code { return m_error; }
+
+auto tristan::sockets::FrameParser::encodePrefix(FramePrefix p_prefix, uint64_t p_size, uint8_t* p_destination) noexcept -> uint8_t {
+    uint8_t l_prefix_size = 0;
+    switch (p_prefix) {
+        case tristan::sockets::FramePrefix::FIXED_8: {
+            l_prefix_size = 1;
+            break;
+        }
+        case tristan::sockets::FramePrefix::FIXED_16: {
+            l_prefix_size = 2;
+            break;
+        }
+        case tristan::sockets::FramePrefix::FIXED_32: {
+            l_prefix_size = 4;
+            break;
+        }
+        case tristan::sockets::FramePrefix::FIXED_64: {
+            l_prefix_size = 8;
+            break;
+        }
+        case tristan::sockets::FramePrefix::VARINT: {
+            uint8_t i = 0;
+            do {
+                auto l_byte = static_cast< uint8_t >(p_size & 0x7F);
+                p_size >>= 7;
+                p_destination[i++] = p_size == 0 ? l_byte : static_cast< uint8_t >(l_byte | 0x80);
+            } while (p_size != 0);
+            return i;
+        }
+    }
+    if (l_prefix_size < 8 && p_size >> (l_prefix_size * 8) != 0) {
+        return 0;
+    }
+    for (uint8_t i = 0; i < l_prefix_size; ++i) {
+        p_destination[l_prefix_size - 1 - i] = static_cast< uint8_t >(p_size >> (i * 8));
+    }
+    return l_prefix_size;
+}
@@ -0,0 +1,473 @@
+#include "http_parser.hpp"
+
+#if defined(__SSE2__)
+  #include <immintrin.h>
+#endif
+
+namespace {
+
+    auto findByte(const uint8_t* p_begin, const uint8_t* p_end, uint8_t p_byte) noexcept -> const uint8_t* {
+#if defined(__AVX2__)
+        const __m256i l_needle = _mm256_set1_epi8(static_cast< char >(p_byte));
+        while (p_end - p_begin >= 32) {
+            auto l_chunk = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(p_begin));
+            auto l_mask = static_cast< uint32_t >(_mm256_movemask_epi8(_mm256_cmpeq_epi8(l_chunk, l_needle)));
+            if (l_mask != 0) {
+                return p_begin + __builtin_ctz(l_mask);
+            }
+            p_begin += 32;
+        }
+#endif
+#if defined(__SSE2__)
+        const __m128i l_needle_16 = _mm_set1_epi8(static_cast< char >(p_byte));
+        while (p_end - p_begin >= 16) {
+            auto l_chunk = _mm_loadu_si128(reinterpret_cast< const __m128i* >(p_begin));
+            auto l_mask = static_cast< uint32_t >(_mm_movemask_epi8(_mm_cmpeq_epi8(l_chunk, l_needle_16)));
+            if (l_mask != 0) {
+                return p_begin + __builtin_ctz(l_mask);
+            }
+            p_begin += 16;
+        }
+#endif
+        for (; p_begin < p_end; ++p_begin) {
+            if (*p_begin == p_byte) {
+                return p_begin;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] auto isTokenChar(uint8_t p_char) noexcept -> bool {
+        if (p_char <= 0x20 || p_char >= 0x7F) {
+            return false;
+        }
+        return std::string_view("()<>@,;:\\\"/[]?={}").find(static_cast< char >(p_char)) == std::string_view::npos;
+    }
+
+    [[nodiscard]] auto toLower(char p_char) noexcept -> char { return (p_char >= 'A' && p_char <= 'Z') ? static_cast< char >(p_char + ('a' - 'A')) : p_char; }
+
+    [[nodiscard]] auto equalsIgnoreCase(std::string_view p_left, std::string_view p_right) noexcept -> bool {
+        if (p_left.size() != p_right.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < p_left.size(); ++i) {
+            if (toLower(p_left[i]) != toLower(p_right[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] auto containsIgnoreCase(std::string_view p_value, std::string_view p_token) noexcept -> bool {
+        if (p_token.size() > p_value.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i + p_token.size() <= p_value.size(); ++i) {
+            if (equalsIgnoreCase(p_value.substr(i, p_token.size()), p_token)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] auto hexValue(uint8_t p_char) noexcept -> int8_t {
+        if (p_char >= '0' && p_char <= '9') {
+            return static_cast< int8_t >(p_char - '0');
+        }
+        if (p_char >= 'a' && p_char <= 'f') {
+            return static_cast< int8_t >(p_char - 'a' + 10);
+        }
+        if (p_char >= 'A' && p_char <= 'F') {
+            return static_cast< int8_t >(p_char - 'A' + 10);
+        }
+        return -1;
+    }
+
+}  // namespace
+
+tristan::sockets::HttpParser::HttpParser(HttpMessageType p_type) :
+    m_headers(),
+    m_data(nullptr),
+    m_scan_offset(0),
+    m_head_size(0),
+    m_method(),
+    m_target(),
+    m_reason(),
+    m_status_code(0),
+    m_header_count(0),
+    m_type(p_type),
+    m_minor_version(0) { }
+
+auto tristan::sockets::HttpParser::parse(std::span< const uint8_t > p_data) -> uint64_t {
+    m_data = p_data.data();
+    if (m_head_size != 0 || m_error) {
+        return m_head_size;
+    }
+    const auto* l_begin = p_data.data();
+    const auto* l_end = l_begin + p_data.size();
+    const auto* l_position = l_begin + m_scan_offset;
+    while (true) {
+        const auto* l_new_line = findByte(l_position, l_end, '\n');
+        if (l_new_line == nullptr) {
+            m_scan_offset = p_data.size();
+            return 0;
+        }
+        if (l_end - l_new_line < 2 || (l_new_line[1] == '\r' && l_end - l_new_line < 3)) {
+            m_scan_offset = static_cast< uint64_t >(l_new_line - l_begin);
+            return 0;
+        }
+        uint64_t l_head_size = 0;
+        if (l_new_line[1] == '\n') {
+            l_head_size = static_cast< uint64_t >(l_new_line - l_begin) + 2;
+        } else if (l_new_line[1] == '\r' && l_new_line[2] == '\n') {
+            l_head_size = static_cast< uint64_t >(l_new_line - l_begin) + 3;
+        }
+        if (l_head_size != 0) {
+            if (not HttpParser::parseHead(l_head_size)) {
+                return 0;
+            }
+            m_head_size = l_head_size;
+            return m_head_size;
+        }
+        l_position = l_new_line + 1;
+    }
+}
+
+void tristan::sockets::HttpParser::rebind(const uint8_t* p_data) noexcept { m_data = p_data; }
+
+void tristan::sockets::HttpParser::reset() noexcept {
+    m_error = {};
+    m_data = nullptr;
+    m_scan_offset = 0;
+    m_head_size = 0;
+    m_method = {};
+    m_target = {};
+    m_reason = {};
+    m_status_code = 0;
+    m_header_count = 0;
+    m_minor_version = 0;
+}
+
+auto tristan::sockets::HttpParser::complete() const noexcept -> bool { return m_head_size != 0; }
+
+auto tristan::sockets::HttpParser::method() const noexcept -> std::string_view { return HttpParser::view(m_method); }
+
+auto tristan::sockets::HttpParser::target() const noexcept -> std::string_view { return HttpParser::view(m_target); }
+
+auto tristan::sockets::HttpParser::reason() const noexcept -> std::string_view { return HttpParser::view(m_reason); }
+
+auto tristan::sockets::HttpParser::statusCode() const noexcept -> uint16_t { return m_status_code; }
+
+auto tristan::sockets::HttpParser::minorVersion() const noexcept -> uint8_t { return m_minor_version; }
+
+auto tristan::sockets::HttpParser::headerCount() const noexcept -> uint16_t { return m_header_count; }
+
+auto tristan::sockets::HttpParser::header(uint16_t p_index) const noexcept -> HttpHeader {
+    if (p_index >= m_header_count) {
+        return {};
+    }
+    return {HttpParser::view(m_headers[p_index].name), HttpParser::view(m_headers[p_index].value)};
+}
+
+auto tristan::sockets::HttpParser::header(std::string_view p_name) const noexcept -> std::optional< std::string_view > {
+    for (uint16_t i = 0; i < m_header_count; ++i) {
+        if (equalsIgnoreCase(HttpParser::view(m_headers[i].name), p_name)) {
+            return HttpParser::view(m_headers[i].value);
+        }
+    }
+    return std::nullopt;
+}
+
+auto tristan::sockets::HttpParser::contentLength() const noexcept -> std::optional< uint64_t > {
+    auto l_value = HttpParser::header("Content-Length");
+    if (not l_value.has_value() || l_value->empty()) {
+        return std::nullopt;
+    }
+    uint64_t l_length = 0;
+    for (auto l_char : l_value.value()) {
+        if (l_char < '0' || l_char > '9' || l_length > (UINT64_MAX - 9) / 10) {
+            return std::nullopt;
+        }
+        l_length = l_length * 10 + static_cast< uint64_t >(l_char - '0');
+    }
+    return l_length;
+}
+
+auto tristan::sockets::HttpParser::chunked() const noexcept -> bool {
+    auto l_value = HttpParser::header("Transfer-Encoding");
+    if (not l_value.has_value() || l_value->size() < 7) {
+        return false;
+    }
+    return equalsIgnoreCase(l_value->substr(l_value->size() - 7), "chunked");
+}
+
+auto tristan::sockets::HttpParser::keepAlive() const noexcept -> bool {
+    auto l_value = HttpParser::header("Connection");
+    if (m_minor_version == 0) {
+        return l_value.has_value() && containsIgnoreCase(l_value.value(), "keep-alive");
+    }
+    return not(l_value.has_value() && containsIgnoreCase(l_value.value(), "close"));
+}
+
+auto tristan::sockets::HttpParser::type() const noexcept -> HttpMessageType { return m_type; }
+
+auto tristan::sockets::HttpParser::error() const noexcept -> std::error_code { return m_error; }
+
+auto tristan::sockets::HttpParser::parseHead(uint64_t p_head_size) -> bool {
+    const auto* l_position = m_data;
+    const auto* l_end = m_data + p_head_size;
+    bool l_start_line = true;
+    while (l_position < l_end) {
+        const auto* l_new_line = findByte(l_position, l_end, '\n');
+        const auto* l_line_end = l_new_line;
+        if (l_line_end > l_position && *(l_line_end - 1) == '\r') {
+            --l_line_end;
+        }
+        auto l_line_size = static_cast< uint64_t >(l_line_end - l_position);
+        if (l_line_size == 0) {
+            break;
+        }
+        if (l_start_line) {
+            if (not HttpParser::parseStartLine(l_position, l_line_size)) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_MALFORMED_START_LINE);
+                return false;
+            }
+            l_start_line = false;
+        } else {
+            if (m_header_count == max_headers) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_TOO_MANY_HEADERS);
+                return false;
+            }
+            const auto* l_colon = findByte(l_position, l_line_end, ':');
+            if (l_colon == nullptr || l_colon == l_position) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_MALFORMED_HEADER);
+                return false;
+            }
+            for (const auto* l_char = l_position; l_char < l_colon; ++l_char) {
+                if (not isTokenChar(*l_char)) {
+                    m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_MALFORMED_HEADER);
+                    return false;
+                }
+            }
+            const auto* l_value_begin = l_colon + 1;
+            while (l_value_begin < l_line_end && (*l_value_begin == ' ' || *l_value_begin == '\t')) {
+                ++l_value_begin;
+            }
+            const auto* l_value_end = l_line_end;
+            while (l_value_end > l_value_begin && (*(l_value_end - 1) == ' ' || *(l_value_end - 1) == '\t')) {
+                --l_value_end;
+            }
+            auto& l_header = m_headers[m_header_count++];
+            l_header.name = {static_cast< uint32_t >(l_position - m_data), static_cast< uint32_t >(l_colon - l_position)};
+            l_header.value = {static_cast< uint32_t >(l_value_begin - m_data), static_cast< uint32_t >(l_value_end - l_value_begin)};
+        }
+        l_position = l_new_line + 1;
+    }
+    if (l_start_line) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_MALFORMED_START_LINE);
+        return false;
+    }
+    return true;
+}
+
+auto tristan::sockets::HttpParser::parseStartLine(const uint8_t* p_line, uint64_t p_size) -> bool {
+    std::string_view l_line(reinterpret_cast< const char* >(p_line), p_size);
+    auto l_offset = static_cast< uint32_t >(p_line - m_data);
+
+    auto parse_version = [this](std::string_view p_version) -> bool {
+        if (p_version.size() != 8 || p_version.substr(0, 7) != "HTTP/1." || p_version[7] < '0' || p_version[7] > '9') {
+            return false;
+        }
+        m_minor_version = static_cast< uint8_t >(p_version[7] - '0');
+        return true;
+    };
+
+    auto l_first_space = l_line.find(' ');
+    if (l_first_space == std::string_view::npos || l_first_space == 0) {
+        return false;
+    }
+    if (m_type == HttpMessageType::REQUEST) {
+        auto l_second_space = l_line.find(' ', l_first_space + 1);
+        if (l_second_space == std::string_view::npos || l_second_space == l_first_space + 1) {
+            return false;
+        }
+        for (std::size_t i = 0; i < l_first_space; ++i) {
+            if (not isTokenChar(static_cast< uint8_t >(l_line[i]))) {
+                return false;
+            }
+        }
+        m_method = {l_offset, static_cast< uint32_t >(l_first_space)};
+        m_target = {static_cast< uint32_t >(l_offset + l_first_space + 1), static_cast< uint32_t >(l_second_space - l_first_space - 1)};
+        return parse_version(l_line.substr(l_second_space + 1));
+    }
+    if (not parse_version(l_line.substr(0, l_first_space))) {
+        return false;
+    }
+    auto l_status = l_line.substr(l_first_space + 1, 3);
+    if (l_status.size() != 3) {
+        return false;
+    }
+    m_status_code = 0;
+    for (auto l_char : l_status) {
+        if (l_char < '0' || l_char > '9') {
+            return false;
+        }
+        m_status_code = static_cast< uint16_t >(m_status_code * 10 + (l_char - '0'));
+    }
+    auto l_reason_offset = l_first_space + 4;
+    if (l_reason_offset < l_line.size()) {
+        if (l_line[l_reason_offset] != ' ') {
+            return false;
+        }
+        m_reason = {static_cast< uint32_t >(l_offset + l_reason_offset + 1), static_cast< uint32_t >(l_line.size() - l_reason_offset - 1)};
+    }
+    return true;
+}
+
+auto tristan::sockets::HttpParser::view(Range p_range) const noexcept -> std::string_view {
+    if (m_data == nullptr || p_range.size == 0) {
+        return {};
+    }
+    return {reinterpret_cast< const char* >(m_data) + p_range.offset, p_range.size};
+}
+
+tristan::sockets::HttpChunkedDecoder::HttpChunkedDecoder() :
+    m_chunk_remaining(0),
+    m_state(State::SIZE),
+    m_size_has_digits(false) { }
+
+auto tristan::sockets::HttpChunkedDecoder::decode(uint8_t* p_destination, std::span< const uint8_t > p_source) -> HttpChunkResult {
+    uint64_t l_consumed = 0;
+    uint64_t l_decoded = 0;
+
+    auto finish_size = [this]() {
+        m_size_has_digits = false;
+        m_state = m_chunk_remaining == 0 ? State::TRAILER_LINE_START : State::DATA;
+    };
+    auto fail = [this]() {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::HTTP_MALFORMED_CHUNK);
+    };
+
+    while (l_consumed < p_source.size() && m_state != State::DONE && not m_error) {
+        auto l_char = p_source[l_consumed];
+        switch (m_state) {
+            case State::SIZE: {
+                auto l_digit = hexValue(l_char);
+                if (l_digit >= 0) {
+                    if (m_chunk_remaining > (UINT64_MAX >> 4)) {
+                        fail();
+                        break;
+                    }
+                    m_chunk_remaining = (m_chunk_remaining << 4) | static_cast< uint64_t >(l_digit);
+                    m_size_has_digits = true;
+                } else if (not m_size_has_digits) {
+                    fail();
+                    break;
+                } else if (l_char == ';' || l_char == ' ' || l_char == '\t') {
+                    m_state = State::EXTENSION;
+                } else if (l_char == '\r') {
+                    m_state = State::SIZE_LF;
+                } else if (l_char == '\n') {
+                    finish_size();
+                } else {
+                    fail();
+                    break;
+                }
+                ++l_consumed;
+                break;
+            }
+            case State::EXTENSION: {
+                if (l_char == '\r') {
+                    m_state = State::SIZE_LF;
+                } else if (l_char == '\n') {
+                    finish_size();
+                }
+                ++l_consumed;
+                break;
+            }
+            case State::SIZE_LF: {
+                if (l_char != '\n') {
+                    fail();
+                    break;
+                }
+                finish_size();
+                ++l_consumed;
+                break;
+            }
+            case State::DATA: {
+                auto l_size = std::min(m_chunk_remaining, p_source.size() - l_consumed);
+                std::memmove(p_destination + l_decoded, p_source.data() + l_consumed, l_size);
+                l_decoded += l_size;
+                l_consumed += l_size;
+                m_chunk_remaining -= l_size;
+                if (m_chunk_remaining == 0) {
+                    m_state = State::DATA_CR;
+                }
+                break;
+            }
+            case State::DATA_CR: {
+                if (l_char == '\r') {
+                    m_state = State::DATA_LF;
+                } else if (l_char == '\n') {
+                    m_state = State::SIZE;
+                } else {
+                    fail();
+                    break;
+                }
+                ++l_consumed;
+                break;
+            }
+            case State::DATA_LF: {
+                if (l_char != '\n') {
+                    fail();
+                    break;
+                }
+                m_state = State::SIZE;
+                ++l_consumed;
+                break;
+            }
+            case State::TRAILER_LINE_START: {
+                if (l_char == '\r') {
+                    m_state = State::TRAILER_END_LF;
+                } else if (l_char == '\n') {
+                    m_state = State::DONE;
+                } else {
+                    m_state = State::TRAILER_LINE;
+                }
+                ++l_consumed;
+                break;
+            }
+            case State::TRAILER_LINE: {
+                if (l_char == '\n') {
+                    m_state = State::TRAILER_LINE_START;
+                }
+                ++l_consumed;
+                break;
+            }
+            case State::TRAILER_END_LF: {
+                if (l_char != '\n') {
+                    fail();
+                    break;
+                }
+                m_state = State::DONE;
+                ++l_consumed;
+                break;
+            }
+            case State::DONE: {
+                break;
+            }
+        }
+    }
+    return {l_decoded, l_consumed};
+}
+
+void tristan::sockets::HttpChunkedDecoder::reset() noexcept {
+    m_error = {};
+    m_chunk_remaining = 0;
+    m_state = State::SIZE;
+    m_size_has_digits = false;
+}
+
+auto tristan::sockets::HttpChunkedDecoder::done() const noexcept -> bool { return m_state == State::DONE; }
+
+auto tristan::sockets::HttpChunkedDecoder::error() const noexcept -> std::error_code { return m_error; }
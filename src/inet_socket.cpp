@@ -1,27 +1,93 @@
 #include "inet_socket.hpp"
+#include "pipe_signal_utility.hpp"
 #include "socket_error.hpp"
+#include "socket_error_utility.hpp"
 #include "ssl.hpp"
 
 #include <netdb.h>
 #include <sys/socket.h>
+#include <sys/ioctl.h>
 #include <sys/fcntl.h>
+#include <sys/sendfile.h>
 #include <arpa/inet.h>
+#include <netinet/tcp.h>
+#include <netinet/udp.h>
+#include <linux/errqueue.h>
+#include <linux/sockios.h>
+#include <poll.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <tuple>
+
+namespace {
+    /**
+     * \brief Maximum number of datagrams passed to single recvmmsg or sendmmsg call
+     */
+    constexpr uint32_t g_datagram_batch_size = 64;
+    /**
+     * \brief Maximum number of segments kernel accepts in single UDP generic segmentation offload send
+     */
+    constexpr uint64_t g_max_gso_segments = 64;
+    /**
+     * \brief Maximum size of UDP payload
+     */
+    constexpr uint64_t g_max_udp_payload = 65507;
+    /**
+     * \brief Time close() waits for zero copy completions before it disconnects
+     */
+    constexpr std::chrono::milliseconds g_zero_copy_close_timeout(1000);
+    /**
+     * \brief Time close() waits for zero copy completions after disconnect dropped send queue
+     */
+    constexpr std::chrono::milliseconds g_zero_copy_disconnect_timeout(100);
+
+    /**
+     * \brief Ancillary data buffer of single message which fits UDP_SEGMENT and UDP_GRO control messages
+     */
+    struct ControlBuffer {
+        alignas(cmsghdr) char data[CMSG_SPACE(sizeof(int32_t))];
+    };
+
+    /**
+     * \brief Returns whether zero copy notification id precedes the other one taking wrap around into account
+     */
+    auto zeroCopyIdBefore(uint32_t p_id, uint32_t p_other) -> bool { return static_cast< int32_t >(p_id - p_other) < 0; }
+
+    auto setOption(int32_t p_socket, int32_t p_level, int32_t p_option, int32_t p_value) -> bool {
+        return ::setsockopt(p_socket, p_level, p_option, &p_value, sizeof(p_value)) == 0;
+    }
+}  // namespace
 
 tristan::sockets::InetSocket::InetSocket(tristan::sockets::SocketType p_socket_type) :
     m_socket(-1),
     m_ip(0),
+    m_memory_resource(std::pmr::get_default_resource()),
     m_port(0),
+    m_zero_copy_threshold(16 * 1024),
+    m_zero_copy_copied(0),
+    m_zero_copy_next_id(0),
+    m_zero_copy_completed_id(0),
+    m_pipe{-1, -1},
+    m_pipe_capacity(0),
+    m_batch_offset(0),
     m_type(p_socket_type),
     m_non_blocking(false),
     m_bound(false),
     m_listening(false),
     m_not_ssl_connected(false),
-    m_connected(false) {
+    m_connected(false),
+    m_segmentation_offload(false),
+    m_receive_offload(false),
+    m_zero_copy(false),
+    m_quick_ack(false) {
 
-    auto protocol = getprotobyname("tcp");
     if (m_type == tristan::sockets::SocketType::STREAM) {
+        auto protocol = getprotobyname("tcp");
         m_socket = socket(AF_INET, SOCK_STREAM, protocol->p_proto);
     } else {
+        auto protocol = getprotobyname("udp");
         m_socket = socket(AF_INET, SOCK_DGRAM, protocol->p_proto);
     }
     if (m_socket < 0) {
@@ -53,6 +119,19 @@ tristan::sockets::InetSocket::InetSocket(tristan::sockets::SocketType p_socket_t
             }
         }
         m_error = tristan::sockets::makeError(error);
+        return;
+    }
+    if (m_type == tristan::sockets::SocketType::DATA) {
+        int32_t segment_size = 0;
+        socklen_t option_length = sizeof(segment_size);
+        m_segmentation_offload = ::getsockopt(m_socket, IPPROTO_UDP, UDP_SEGMENT, &segment_size, &option_length) == 0;
+    }
+}
+
+tristan::sockets::InetSocket::InetSocket(tristan::sockets::SocketType p_socket_type, const SocketOptions& p_options) :
+    InetSocket(p_socket_type) {
+    if (m_socket != -1) {
+        InetSocket::setOptions(p_options);
     }
 }
 
@@ -60,12 +139,16 @@ tristan::sockets::InetSocket::~InetSocket() { InetSocket::close(); }
 
 void tristan::sockets::InetSocket::setHost(uint32_t p_ip, const std::string& p_host_name) {
     m_ip = p_ip;
+    m_remote_endpoint = tristan::sockets::Endpoint::inet(m_ip, m_port);
     if (not p_host_name.empty()) {
         m_host_name = p_host_name;
     }
 }
 
-void tristan::sockets::InetSocket::setPort(uint16_t p_port) { m_port = p_port; }
+void tristan::sockets::InetSocket::setPort(uint16_t p_port) {
+    m_port = p_port;
+    m_remote_endpoint = tristan::sockets::Endpoint::inet(m_ip, m_port);
+}
 
 void tristan::sockets::InetSocket::setNonBlocking(bool p_non_blocking) {
     if (m_socket == -1) {
@@ -107,6 +190,153 @@ void tristan::sockets::InetSocket::setTimeOut(std::chrono::seconds p_seconds) {
     }
 }
 
+void tristan::sockets::InetSocket::setOptions(const SocketOptions& p_options) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    m_options = p_options;
+    m_failed_options.clear();
+    bool stream = m_type == tristan::sockets::SocketType::STREAM;
+    if (stream && p_options.no_delay && not setOption(m_socket, IPPROTO_TCP, TCP_NODELAY, *p_options.no_delay ? 1 : 0)) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::NO_DELAY);
+    }
+    m_quick_ack = false;
+    if (stream && p_options.quick_ack) {
+        if (setOption(m_socket, IPPROTO_TCP, TCP_QUICKACK, *p_options.quick_ack ? 1 : 0)) {
+            m_quick_ack = *p_options.quick_ack;
+        } else {
+            m_failed_options.push_back(tristan::sockets::SocketOption::QUICK_ACK);
+        }
+    }
+    if (p_options.priority && not setOption(m_socket, SOL_SOCKET, SO_PRIORITY, *p_options.priority)) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::PRIORITY);
+    }
+    if (p_options.type_of_service && not setOption(m_socket, IPPROTO_IP, IP_TOS, *p_options.type_of_service)) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::TYPE_OF_SERVICE);
+    }
+    if (p_options.reuse_address && not setOption(m_socket, SOL_SOCKET, SO_REUSEADDR, *p_options.reuse_address ? 1 : 0)) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::REUSE_ADDRESS);
+    }
+    if (p_options.reuse_port && not setOption(m_socket, SOL_SOCKET, SO_REUSEPORT, *p_options.reuse_port ? 1 : 0)) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::REUSE_PORT);
+    }
+    if (p_options.send_buffer_size
+        && not setOption(m_socket, SOL_SOCKET, SO_SNDBUF, static_cast< int32_t >(std::min< uint32_t >(*p_options.send_buffer_size, std::numeric_limits< int32_t >::max())))) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::SEND_BUFFER_SIZE);
+    }
+    if (p_options.receive_buffer_size
+        && not setOption(m_socket, SOL_SOCKET, SO_RCVBUF, static_cast< int32_t >(std::min< uint32_t >(*p_options.receive_buffer_size, std::numeric_limits< int32_t >::max())))) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::RECEIVE_BUFFER_SIZE);
+    }
+    if (p_options.abortive_close) {
+        linger linger_option{*p_options.abortive_close ? 1 : 0, 0};
+        if (::setsockopt(m_socket, SOL_SOCKET, SO_LINGER, &linger_option, sizeof(linger_option)) < 0) {
+            m_failed_options.push_back(tristan::sockets::SocketOption::ABORTIVE_CLOSE);
+        }
+    }
+    if (p_options.bind_address_no_port && not setOption(m_socket, IPPROTO_IP, IP_BIND_ADDRESS_NO_PORT, *p_options.bind_address_no_port ? 1 : 0)) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::BIND_ADDRESS_NO_PORT);
+    }
+    if (stream && p_options.keep_alive && not setOption(m_socket, SOL_SOCKET, SO_KEEPALIVE, *p_options.keep_alive ? 1 : 0)) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::KEEP_ALIVE);
+    }
+    if (stream && p_options.keep_alive_idle
+        && not setOption(m_socket, IPPROTO_TCP, TCP_KEEPIDLE, static_cast< int32_t >(std::clamp< int64_t >(p_options.keep_alive_idle->count(), 1, 32767)))) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::KEEP_ALIVE_IDLE);
+    }
+    if (stream && p_options.keep_alive_interval
+        && not setOption(m_socket, IPPROTO_TCP, TCP_KEEPINTVL, static_cast< int32_t >(std::clamp< int64_t >(p_options.keep_alive_interval->count(), 1, 32767)))) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::KEEP_ALIVE_INTERVAL);
+    }
+    if (stream && p_options.keep_alive_count
+        && not setOption(m_socket, IPPROTO_TCP, TCP_KEEPCNT, static_cast< int32_t >(std::clamp< uint32_t >(*p_options.keep_alive_count, 1, 127)))) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::KEEP_ALIVE_COUNT);
+    }
+    if (stream && p_options.user_timeout
+        && not setOption(m_socket,
+                         IPPROTO_TCP,
+                         TCP_USER_TIMEOUT,
+                         static_cast< int32_t >(std::clamp< int64_t >(p_options.user_timeout->count(), 0, std::numeric_limits< int32_t >::max())))) {
+        m_failed_options.push_back(tristan::sockets::SocketOption::USER_TIMEOUT);
+    }
+    if (not m_failed_options.empty()) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+void tristan::sockets::InetSocket::setReceiveLowWatermark(uint32_t p_bytes) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    auto low_watermark = static_cast< int32_t >(std::clamp< uint32_t >(p_bytes, 1, std::numeric_limits< int32_t >::max()));
+    if (::setsockopt(m_socket, SOL_SOCKET, SO_RCVLOWAT, &low_watermark, sizeof(low_watermark)) < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+void tristan::sockets::InetSocket::setDeferAccept(std::chrono::seconds p_timeout) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    auto timeout = static_cast< int32_t >(std::clamp< int64_t >(p_timeout.count(), 0, std::numeric_limits< int32_t >::max()));
+    if (::setsockopt(m_socket, IPPROTO_TCP, TCP_DEFER_ACCEPT, &timeout, sizeof(timeout)) < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+void tristan::sockets::InetSocket::setNotSentLowWatermark(uint32_t p_bytes) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    if (::setsockopt(m_socket, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &p_bytes, sizeof(p_bytes)) < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+void tristan::sockets::InetSocket::setSendBufferSize(uint32_t p_bytes) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    auto size = static_cast< int32_t >(std::min< uint32_t >(p_bytes, std::numeric_limits< int32_t >::max()));
+    if (::setsockopt(m_socket, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size)) < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+void tristan::sockets::InetSocket::setReceiveBufferSize(uint32_t p_bytes) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    auto size = static_cast< int32_t >(std::min< uint32_t >(p_bytes, std::numeric_limits< int32_t >::max()));
+    if (::setsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)) < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+auto tristan::sockets::InetSocket::sendBufferSize() const -> uint32_t {
+    int32_t size = 0;
+    socklen_t size_length = sizeof(size);
+    if (m_socket == -1 || ::getsockopt(m_socket, SOL_SOCKET, SO_SNDBUF, &size, &size_length) < 0) {
+        return 0;
+    }
+    return static_cast< uint32_t >(size);
+}
+
+auto tristan::sockets::InetSocket::receiveBufferSize() const -> uint32_t {
+    int32_t size = 0;
+    socklen_t size_length = sizeof(size);
+    if (m_socket == -1 || ::getsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &size, &size_length) < 0) {
+        return 0;
+    }
+    return static_cast< uint32_t >(size);
+}
+
 void tristan::sockets::InetSocket::resetError() { m_error = tristan::sockets::makeError(tristan::sockets::Error::SUCCESS); }
 
 void tristan::sockets::InetSocket::bind() {
@@ -123,37 +353,33 @@ void tristan::sockets::InetSocket::bind() {
     address.sin_port = m_port;
     auto status = ::bind(m_socket, reinterpret_cast< struct sockaddr* >(&address), sizeof(address));
     if (status < 0) {
-        tristan::sockets::Error error{};
-        switch (errno) {
-            case EACCES: {
-                error = tristan::sockets::Error::BIND_NOT_ENOUGH_PERMISSIONS;
-                break;
-            }
-            case EADDRINUSE: {
-                error = tristan::sockets::Error::BIND_ADDRESS_IN_USE;
-                break;
-            }
-            case EBADF: {
-                error = tristan::sockets::Error::BIND_BAD_FILE_DESCRIPTOR;
-                break;
-            }
-            case EINVAL: {
-                error = tristan::sockets::Error::BIND_ALREADY_BOUND;
-                break;
-            }
-            case ENOTSOCK: {
-                error = tristan::sockets::Error::BIND_FILE_DESCRIPTOR_IS_NOT_SOCKET;
-                break;
-            }
-        }
-        m_error = tristan::sockets::makeError(error);
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::bindErrorFromErrno(errno));
     }
     if (not m_error) {
         m_bound = true;
     }
 }
 
-void tristan::sockets::InetSocket::listen(uint32_t p_connection_count_limit) {
+void tristan::sockets::InetSocket::bindSource(uint32_t p_ip, uint16_t p_port) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    if (m_listening) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::CONNECT_SOCKET_IS_IN_LISTEN_MODE);
+        return;
+    }
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = p_ip;
+    address.sin_port = p_port;
+    auto status = ::bind(m_socket, reinterpret_cast< struct sockaddr* >(&address), sizeof(address));
+    if (status < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::bindErrorFromErrno(errno));
+    }
+}
+
+void tristan::sockets::InetSocket::listen(uint32_t p_connection_count_limit, uint32_t p_fast_open_queue_length, std::chrono::seconds p_defer_accept) {
     if (m_socket == -1) {
         m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
         return;
@@ -166,6 +392,13 @@ void tristan::sockets::InetSocket::listen(uint32_t p_connection_count_limit) {
         m_error = tristan::sockets::makeError(tristan::sockets::Error::LISTEN_NOT_BOUND);
         return;
     }
+    if (p_fast_open_queue_length > 0
+        && not setOption(m_socket, IPPROTO_TCP, TCP_FASTOPEN, static_cast< int32_t >(std::min< uint32_t >(p_fast_open_queue_length, std::numeric_limits< int32_t >::max())))) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+    if (p_defer_accept.count() > 0) {
+        InetSocket::setDeferAccept(p_defer_accept);
+    }
     auto status = ::listen(m_socket, static_cast< int32_t >(p_connection_count_limit));
     if (status < 0) {
         tristan::sockets::Error error{};
@@ -201,92 +434,13 @@ void tristan::sockets::InetSocket::connect(bool p_ssl) {
         m_error = tristan::sockets::makeError(tristan::sockets::Error::CONNECT_SOCKET_IS_IN_LISTEN_MODE);
         return;
     }
+    if (m_type == tristan::sockets::SocketType::DATA) {
+        p_ssl = false;
+    }
     if (not m_not_ssl_connected) {
-        sockaddr_in remote_address{};
-        remote_address.sin_family = AF_INET;
-        remote_address.sin_addr.s_addr = m_ip;
-        remote_address.sin_port = m_port;
-        int32_t status = ::connect(m_socket, reinterpret_cast< struct sockaddr* >(&remote_address), sizeof(remote_address));
+        int32_t status = ::connect(m_socket, m_remote_endpoint.address(), m_remote_endpoint.length());
         if (status < 0) {
-            tristan::sockets::Error error{};
-            switch (errno) {
-                case EACCES: {
-                    [[fallthrough]];
-                }
-                case EPERM: {
-                    error = tristan::sockets::Error::CONNECT_NOT_ENOUGH_PERMISSIONS;
-                    break;
-                }
-                case EADDRINUSE: {
-                    error = tristan::sockets::Error::CONNECT_ADDRESS_IN_USE;
-                    break;
-                }
-                case EADDRNOTAVAIL: {
-                    error = tristan::sockets::Error::CONNECT_ADDRESS_NOT_AVAILABLE;
-                    break;
-                }
-                case EAFNOSUPPORT: {
-                    error = tristan::sockets::Error::CONNECT_AF_NOT_SUPPORTED;
-                    break;
-                }
-                case EAGAIN: {
-                    if (m_non_blocking) {
-                        error = tristan::sockets::Error::CONNECT_TRY_AGAIN;
-                    } else {
-                        error = tristan::sockets::Error::SOCKET_TIMED_OUT;
-                    }
-                    break;
-                }
-                case EALREADY: {
-                    error = tristan::sockets::Error::CONNECT_ALREADY_IN_PROCESS;
-                    break;
-                }
-                case EBADF: {
-                    error = tristan::sockets::Error::CONNECT_BAD_FILE_DESCRIPTOR;
-                    break;
-                }
-                case ECONNREFUSED: {
-                    error = tristan::sockets::Error::CONNECT_CONNECTION_REFUSED;
-                    break;
-                }
-                case EFAULT: {
-                    error = tristan::sockets::Error::CONNECT_ADDRESS_OUTSIDE_USER_SPACE;
-                    break;
-                }
-                case EINPROGRESS: {
-                    if (m_non_blocking) {
-                        error = tristan::sockets::Error::CONNECT_IN_PROGRESS;
-                    } else {
-                        error = tristan::sockets::Error::SOCKET_TIMED_OUT;
-                    }
-                    break;
-                }
-                case EINTR: {
-                    error = tristan::sockets::Error::CONNECT_INTERRUPTED;
-                    break;
-                }
-                case EISCONN: {
-                    error = tristan::sockets::Error::CONNECT_CONNECTED;
-                    break;
-                }
-                case ENETUNREACH: {
-                    error = tristan::sockets::Error::CONNECT_NETWORK_UNREACHABLE;
-                    break;
-                }
-                case ENOTSOCK: {
-                    error = tristan::sockets::Error::CONNECT_FILE_DESCRIPTOR_IS_NOT_SOCKET;
-                    break;
-                }
-                case EPROTOTYPE: {
-                    error = tristan::sockets::Error::CONNECT_PROTOCOL_NOT_SUPPORTED;
-                    break;
-                }
-                case ETIMEDOUT: {
-                    error = tristan::sockets::Error::SOCKET_TIMED_OUT;
-                    break;
-                }
-            }
-            m_error = tristan::sockets::makeError(error);
+            m_error = tristan::sockets::makeError(tristan::sockets::utility::connectErrorFromErrno(errno, m_non_blocking));
             return;
         }
         m_not_ssl_connected = true;
@@ -330,7 +484,74 @@ void tristan::sockets::InetSocket::connect(bool p_ssl) {
     }
 }
 
+auto tristan::sockets::InetSocket::connect(std::span< const uint8_t > p_initial_data) -> uint64_t {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (m_listening) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::CONNECT_SOCKET_IS_IN_LISTEN_MODE);
+        return 0;
+    }
+    if (m_not_ssl_connected) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::CONNECT_CONNECTED);
+        return 0;
+    }
+
+    auto status = ::sendto(m_socket,
+                           p_initial_data.data(),
+                           p_initial_data.size(),
+                           MSG_FASTOPEN | MSG_NOSIGNAL,
+                           m_remote_endpoint.address(),
+                           m_remote_endpoint.length());
+    if (status < 0) {
+        if (errno == EOPNOTSUPP) {
+            InetSocket::connect(false);
+            if (m_error) {
+                return 0;
+            }
+            return InetSocket::writeBytes(p_initial_data.data(), p_initial_data.size());
+        }
+        auto error = tristan::sockets::utility::connectErrorFromErrno(errno, m_non_blocking);
+        if (error == tristan::sockets::Error::SUCCESS) {
+            error = tristan::sockets::utility::writeErrorFromErrno(errno, m_non_blocking);
+        }
+        m_error = tristan::sockets::makeError(error);
+        return 0;
+    }
+    m_not_ssl_connected = true;
+    m_connected = true;
+    return static_cast< uint64_t >(status);
+}
+
+void tristan::sockets::InetSocket::setFastOpen(bool p_enable) {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    if (not setOption(m_socket, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, p_enable ? 1 : 0)) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+auto tristan::sockets::InetSocket::fastOpenUsed() const -> bool {
+
+    tcp_info info{};
+    socklen_t info_length = sizeof(info);
+    if (::getsockopt(m_socket, IPPROTO_TCP, TCP_INFO, &info, &info_length) < 0) {
+        return false;
+    }
+    return (info.tcpi_options & TCPI_OPT_SYN_DATA) != 0;
+}
+
 void tristan::sockets::InetSocket::close() {
+    if (not m_zero_copy_writes.empty()) {
+        InetSocket::drainZeroCopy();
+    }
+    m_zero_copy_writes.clear();
+    m_zero_copy_completed_ranges.clear();
     if (m_ssl) {
         if (m_error.value() != static_cast< int >(tristan::sockets::Error::SSL_IO_ERROR)
             && m_error.value() != static_cast< int >(tristan::sockets::Error::SSL_FATAL_ERROR)) {
@@ -338,7 +559,11 @@ void tristan::sockets::InetSocket::close() {
         }
         m_ssl.reset();
     }
-    ::close(m_socket);
+    InetSocket::closePipe();
+    if (m_socket != -1) {
+        ::close(m_socket);
+        m_socket = -1;
+    }
 }
 
 void tristan::sockets::InetSocket::shutdown() {
@@ -488,7 +713,11 @@ auto tristan::sockets::InetSocket::accept() -> std::optional< std::unique_ptr< t
     }
     socket->setPort(peer_address.sin_port);
     socket->setHost(peer_address.sin_addr.s_addr);
+    socket->m_memory_resource = m_memory_resource;
+    socket->m_zero_copy = m_zero_copy;
+    socket->m_zero_copy_threshold = m_zero_copy_threshold;
     socket->m_connected = true;
+    socket->setOptions(m_options);
     return socket;
 }
 
@@ -519,11 +748,7 @@ auto tristan::sockets::InetSocket::write(uint8_t p_byte) -> uint8_t {
         if (m_type == tristan::sockets::SocketType::STREAM) {
             m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_CONNECTED);
         } else {
-            sockaddr_in remote_address{};
-            remote_address.sin_family = AF_INET;
-            remote_address.sin_addr.s_addr = m_ip;
-            remote_address.sin_port = m_port;
-            bytes_sent = ::sendto(m_socket, &p_byte, 1, MSG_NOSIGNAL, reinterpret_cast< struct sockaddr* >(&remote_address), sizeof(remote_address));
+            bytes_sent = ::sendto(m_socket, &p_byte, 1, MSG_NOSIGNAL, m_remote_endpoint.address(), m_remote_endpoint.length());
         }
     }
     if (static_cast< int8_t >(bytes_sent) < 0) {
@@ -563,6 +788,10 @@ auto tristan::sockets::InetSocket::write(uint8_t p_byte) -> uint8_t {
                 error = tristan::sockets::Error::WRITE_CONNECTION_RESET;
                 break;
             }
+            case ETIMEDOUT: {
+                error = tristan::sockets::Error::PEER_DEAD;
+                break;
+            }
             case EDESTADDRREQ: {
                 error = tristan::sockets::Error::WRITE_DESTINATION_ADDRESS;
                 break;
@@ -627,43 +856,38 @@ auto tristan::sockets::InetSocket::write(const std::vector< uint8_t >& p_data, u
         return 0;
     }
 
-    uint64_t bytes_sent = 0;
     uint64_t l_size = (p_size == 0 ? p_data.size() : p_size);
 
-    if (m_connected) {
-        if (m_ssl) {
-            auto ssl_write_result = m_ssl->write(p_data, l_size, p_offset);
-            bytes_sent = ssl_write_result.second;
-            if (ssl_write_result.first && ssl_write_result.first.value() == static_cast< int >(tristan::sockets::Error::SSL_TRY_AGAIN)) {
-                m_error = tristan::sockets::makeError(tristan::sockets::Error::WRITE_TRY_AGAIN);
-            } else {
-                m_error = ssl_write_result.first;
-            }
-            return bytes_sent;
-        }
-        bytes_sent = ::send(m_socket, p_data.data() + p_offset, l_size, MSG_NOSIGNAL);
-    } else {
-        if (m_type == tristan::sockets::SocketType::STREAM) {
-            m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_CONNECTED);
+    return InetSocket::writeBytes(p_data.data() + p_offset, l_size);
+}
+
+auto tristan::sockets::InetSocket::read() -> uint8_t {
+
+    uint8_t byte = 0;
+    InetSocket::rearmQuickAck(InetSocket::readByte(byte));
+    return byte;
+}
+
+auto tristan::sockets::InetSocket::readByte(uint8_t& p_byte) -> uint64_t {
+
+    if (m_ssl) {
+        auto ssl_read_status = m_ssl->read();
+        p_byte = ssl_read_status.second;
+        if (ssl_read_status.first && ssl_read_status.first.value() == static_cast< int >(tristan::sockets::Error::SSL_TRY_AGAIN)) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::WRITE_TRY_AGAIN);
         } else {
-            sockaddr_in remote_address{};
-            remote_address.sin_family = AF_INET;
-            remote_address.sin_addr.s_addr = m_ip;
-            remote_address.sin_port = m_port;
-            bytes_sent
-                = ::sendto(m_socket, p_data.data() + p_offset, l_size, MSG_NOSIGNAL, reinterpret_cast< struct sockaddr* >(&remote_address), sizeof(remote_address));
+            m_error = ssl_read_status.first;
         }
+        return ssl_read_status.first ? 0 : 1;
     }
-    if (static_cast< int64_t >(bytes_sent) < 0) {
+
+    auto status = ::recv(m_socket, &p_byte, 1, 0);
+    if (status < 0) {
         tristan::sockets::Error error{};
         switch (errno) {
-            case EACCES: {
-                error = tristan::sockets::Error::WRITE_ACCESS;
-                break;
-            }
             case EAGAIN: {
                 if (m_non_blocking) {
-                    error = tristan::sockets::Error::WRITE_TRY_AGAIN;
+                    error = tristan::sockets::Error::READ_TRY_AGAIN;
                 } else {
                     error = tristan::sockets::Error::SOCKET_TIMED_OUT;
                 }
@@ -672,160 +896,61 @@ auto tristan::sockets::InetSocket::write(const std::vector< uint8_t >& p_data, u
 #if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
             case EWOULDBLOCK: {
                 if (m_non_blocking) {
-                    error = tristan::sockets::Error::WRITE_TRY_AGAIN;
+                    error = tristan::sockets::Error::READ_TRY_AGAIN;
                 } else {
                     error = tristan::sockets::Error::SOCKET_TIMED_OUT;
                 }
                 break;
             }
 #endif
-            case EALREADY: {
-                error = tristan::sockets::Error::WRITE_ALREADY;
-                break;
-            }
             case EBADF: {
-                error = tristan::sockets::Error::WRITE_BAD_FILE_DESCRIPTOR;
-                break;
-            }
-            case ECONNRESET: {
-                error = tristan::sockets::Error::WRITE_CONNECTION_RESET;
+                error = tristan::sockets::Error::READ_BAD_FILE_DESCRIPTOR;
                 break;
             }
-            case EDESTADDRREQ: {
-                error = tristan::sockets::Error::WRITE_DESTINATION_ADDRESS;
+            case ECONNREFUSED: {
+                error = tristan::sockets::Error::READ_CONNECTION_REFUSED;
                 break;
             }
             case EFAULT: {
-                error = tristan::sockets::Error::WRITE_BUFFER_OUT_OF_RANGE;
+                error = tristan::sockets::Error::READ_BUFFER_OUT_OF_RANGE;
                 break;
             }
             case EINTR: {
-                error = tristan::sockets::Error::WRITE_INTERRUPTED;
+                error = tristan::sockets::Error::READ_INTERRUPTED;
                 break;
             }
             case EINVAL: {
-                error = tristan::sockets::Error::WRITE_INVALID_ARGUMENT;
-                break;
-            }
-            case EISCONN: {
-                error = tristan::sockets::Error::WRITE_IS_CONNECTED;
-                break;
-            }
-            case EMSGSIZE: {
-                error = tristan::sockets::Error::WRITE_MESSAGE_SIZE;
-                break;
-            }
-            case ENOBUFS: {
-                error = tristan::sockets::Error::WRITE_NO_BUFFER;
+                error = tristan::sockets::Error::READ_INVALID_FILE_DESCRIPTOR;
                 break;
             }
             case ENOMEM: {
-                error = tristan::sockets::Error::WRITE_NO_MEMORY;
+                error = tristan::sockets::Error::READ_NO_MEMORY;
                 break;
             }
             case ENOTCONN: {
-                error = tristan::sockets::Error::WRITE_NOT_CONNECTED;
+                error = tristan::sockets::Error::READ_NOT_CONNECTED;
                 break;
             }
             case ENOTSOCK: {
-                error = tristan::sockets::Error::WRITE_NOT_SOCKET;
+                error = tristan::sockets::Error::READ_NOT_SOCKET;
                 break;
             }
-            case EOPNOTSUPP: {
-                error = tristan::sockets::Error::WRITE_NOT_SUPPORTED;
+            case ECONNRESET: {
+                error = tristan::sockets::Error::READ_CONNECTION_RESET;
                 break;
             }
-            case EPIPE: {
-                error = tristan::sockets::Error::WRITE_PIPE;
+            case ETIMEDOUT: {
+                error = tristan::sockets::Error::PEER_DEAD;
                 break;
             }
         }
         m_error = tristan::sockets::makeError(error);
     }
-    return bytes_sent;
-}
-
-auto tristan::sockets::InetSocket::read() -> uint8_t {
-
-    uint8_t byte = 0;
-
-    if (m_ssl) {
-        auto ssl_read_status = m_ssl->read();
-        byte = ssl_read_status.second;
-        if (ssl_read_status.first && ssl_read_status.first.value() == static_cast< int >(tristan::sockets::Error::SSL_TRY_AGAIN)) {
-            m_error = tristan::sockets::makeError(tristan::sockets::Error::WRITE_TRY_AGAIN);
-        } else {
-            m_error = ssl_read_status.first;
-        }
-        return byte;
-    }
-
-    auto status = ::recv(m_socket, &byte, 1, 0);
-    if (status < 0) {
-        tristan::sockets::Error error{};
-        switch (errno) {
-            case EAGAIN: {
-                if (m_non_blocking) {
-                    error = tristan::sockets::Error::READ_TRY_AGAIN;
-                } else {
-                    error = tristan::sockets::Error::SOCKET_TIMED_OUT;
-                }
-                break;
-            }
-#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
-            case EWOULDBLOCK: {
-                if (m_non_blocking) {
-                    error = tristan::sockets::Error::READ_TRY_AGAIN;
-                } else {
-                    error = tristan::sockets::Error::SOCKET_TIMED_OUT;
-                }
-                break;
-            }
-#endif
-            case EBADF: {
-                error = tristan::sockets::Error::READ_BAD_FILE_DESCRIPTOR;
-                break;
-            }
-            case ECONNREFUSED: {
-                error = tristan::sockets::Error::READ_CONNECTION_REFUSED;
-                break;
-            }
-            case EFAULT: {
-                error = tristan::sockets::Error::READ_BUFFER_OUT_OF_RANGE;
-                break;
-            }
-            case EINTR: {
-                error = tristan::sockets::Error::READ_INTERRUPTED;
-                break;
-            }
-            case EINVAL: {
-                error = tristan::sockets::Error::READ_INVALID_FILE_DESCRIPTOR;
-                break;
-            }
-            case ENOMEM: {
-                error = tristan::sockets::Error::READ_NO_MEMORY;
-                break;
-            }
-            case ENOTCONN: {
-                error = tristan::sockets::Error::READ_NOT_CONNECTED;
-                break;
-            }
-            case ENOTSOCK: {
-                error = tristan::sockets::Error::READ_NOT_SOCKET;
-                break;
-            }
-            case ECONNRESET: {
-                error = tristan::sockets::Error::READ_CONNECTION_RESET;
-                break;
-            }
-        }
-        m_error = tristan::sockets::makeError(error);
-    }
-    if (status == 0 || byte == 255) {
+    if (status == 0 || p_byte == 255) {
         m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_EOF);
-        byte = 0;
+        p_byte = 0;
     }
-    return byte;
+    return status > 0 ? 1 : 0;
 }
 
 auto tristan::sockets::InetSocket::read(uint16_t p_size) -> std::vector< uint8_t > {
@@ -843,11 +968,13 @@ auto tristan::sockets::InetSocket::read(uint16_t p_size) -> std::vector< uint8_t
         } else {
             m_error = ssl_read_status.first;
         }
+        InetSocket::rearmQuickAck(data.size());
         return data;
     }
 
     data.resize(p_size);
     auto status = ::recv(m_socket, data.data(), p_size, 0);
+    InetSocket::rearmQuickAck(status > 0 ? static_cast< uint64_t >(status) : 0);
     if (status < 0) {
         tristan::sockets::Error error{};
         switch (errno) {
@@ -905,6 +1032,10 @@ auto tristan::sockets::InetSocket::read(uint16_t p_size) -> std::vector< uint8_t
                 error = tristan::sockets::Error::READ_CONNECTION_RESET;
                 break;
             }
+            case ETIMEDOUT: {
+                error = tristan::sockets::Error::PEER_DEAD;
+                break;
+            }
         }
         m_error = tristan::sockets::makeError(error);
     } else if (status == 0){
@@ -917,12 +1048,52 @@ auto tristan::sockets::InetSocket::read(uint16_t p_size) -> std::vector< uint8_t
     return data;
 }
 
+auto tristan::sockets::InetSocket::readSome(std::span< uint8_t > p_buffer) -> uint64_t {
+
+    auto bytes_read = InetSocket::receive(p_buffer);
+    InetSocket::rearmQuickAck(bytes_read);
+    return bytes_read;
+}
+
+auto tristan::sockets::InetSocket::receive(std::span< uint8_t > p_buffer) -> uint64_t {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (p_buffer.empty()) {
+        return 0;
+    }
+
+    if (m_ssl) {
+        auto ssl_read_status = m_ssl->read(p_buffer.data(), p_buffer.size());
+        if (ssl_read_status.first && ssl_read_status.first.value() == static_cast< int >(tristan::sockets::Error::SSL_TRY_AGAIN)) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_TRY_AGAIN);
+        } else if (ssl_read_status.first) {
+            m_error = ssl_read_status.first;
+        }
+        return ssl_read_status.second;
+    }
+
+    auto status = ::recv(m_socket, p_buffer.data(), p_buffer.size(), 0);
+    if (status < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, m_non_blocking));
+        return 0;
+    }
+    if (status == 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_EOF);
+    }
+    return static_cast< uint64_t >(status);
+}
+
 auto tristan::sockets::InetSocket::readUntil(uint8_t p_delimiter) -> std::vector< uint8_t > {
 
     std::vector< uint8_t > data;
+    uint64_t bytes_read = 0;
 
     while (true) {
-        uint8_t byte = InetSocket::read();
+        uint8_t byte = 0;
+        bytes_read += InetSocket::readByte(byte);
         if (m_error || byte == 0) {
             break;
         }
@@ -932,6 +1103,7 @@ auto tristan::sockets::InetSocket::readUntil(uint8_t p_delimiter) -> std::vector
         }
         data.push_back(byte);
     }
+    InetSocket::rearmQuickAck(bytes_read);
     if (not data.empty()) {
         data.shrink_to_fit();
     }
@@ -942,8 +1114,10 @@ auto tristan::sockets::InetSocket::readUntil(const std::vector< uint8_t >& p_del
 
     std::vector< uint8_t > data;
     data.reserve(p_delimiter.size());
+    uint64_t bytes_read = 0;
     while (true) {
-        uint8_t byte = InetSocket::read();
+        uint8_t byte = 0;
+        bytes_read += InetSocket::readByte(byte);
         if (m_error || byte == 0) {
             break;
         }
@@ -959,6 +1133,7 @@ auto tristan::sockets::InetSocket::readUntil(const std::vector< uint8_t >& p_del
             break;
         }
     }
+    InetSocket::rearmQuickAck(bytes_read);
 
     if (m_error.value() == static_cast< int >(tristan::sockets::Error::READ_DONE)) {
         data.erase(data.end() - static_cast< int64_t >(p_delimiter.size()), data.end());
@@ -969,23 +1144,711 @@ auto tristan::sockets::InetSocket::readUntil(const std::vector< uint8_t >& p_del
     return data;
 }
 
+auto tristan::sockets::InetSocket::read(uint16_t p_size, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t > {
+
+    std::pmr::vector< uint8_t > data(p_resource == nullptr ? m_memory_resource : p_resource);
+
+    if (p_size == 0) {
+        return data;
+    }
+
+    if (m_ssl) {
+        auto ssl_read_status = m_ssl->read(data, p_size);
+        if (ssl_read_status.first && ssl_read_status.first.value() == static_cast< int >(tristan::sockets::Error::SSL_TRY_AGAIN)) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_TRY_AGAIN);
+        } else if (ssl_read_status.first) {
+            m_error = ssl_read_status.first;
+        }
+        InetSocket::rearmQuickAck(data.size());
+        return data;
+    }
+
+    data.resize(p_size);
+    data.resize(InetSocket::readSome(data));
+    return data;
+}
+
+auto tristan::sockets::InetSocket::readUntil(uint8_t p_delimiter, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t > {
+
+    return InetSocket::readUntil(std::span< const uint8_t >(&p_delimiter, 1), p_resource);
+}
+
+auto tristan::sockets::InetSocket::readUntil(std::span< const uint8_t > p_delimiter, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t > {
+
+    std::pmr::vector< uint8_t > data(p_resource == nullptr ? m_memory_resource : p_resource);
+
+    if (p_delimiter.empty()) {
+        return data;
+    }
+
+    uint8_t byte = 0;
+    uint64_t bytes_read = 0;
+    while (InetSocket::receive({&byte, 1}) == 1) {
+        ++bytes_read;
+        data.push_back(byte);
+        if (data.size() >= p_delimiter.size() && std::equal(p_delimiter.begin(), p_delimiter.end(), data.end() - static_cast< int64_t >(p_delimiter.size()))) {
+            data.resize(data.size() - p_delimiter.size());
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_DONE);
+            break;
+        }
+    }
+    InetSocket::rearmQuickAck(bytes_read);
+    return data;
+}
+
+auto tristan::sockets::InetSocket::sendFile(int32_t p_file_descriptor, uint64_t p_offset, uint64_t p_size) -> uint64_t {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (m_ssl) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::FILE_TRANSFER_WITH_SSL);
+        return 0;
+    }
+    if (not m_connected) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_CONNECTED);
+        return 0;
+    }
+
+    auto offset = static_cast< off_t >(p_offset);
+    uint64_t bytes_sent = 0;
+
+    while (bytes_sent < p_size) {
+        auto status = tristan::sockets::utility::withoutPipeSignal([&] {
+            return ::sendfile(m_socket, p_file_descriptor, &offset, p_size - bytes_sent);
+        });
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            auto error = tristan::sockets::utility::writeErrorFromErrno(errno, m_non_blocking);
+            m_error = tristan::sockets::makeError(error == tristan::sockets::Error::SUCCESS ? tristan::sockets::Error::FILE_TRANSFER_IO_ERROR : error);
+            break;
+        }
+        if (status == 0) {
+            break;
+        }
+        bytes_sent += static_cast< uint64_t >(status);
+    }
+    return bytes_sent;
+}
+
+auto tristan::sockets::InetSocket::receiveToFile(int32_t p_file_descriptor, uint64_t p_size) -> uint64_t {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (m_ssl) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::FILE_TRANSFER_WITH_SSL);
+        return 0;
+    }
+    if (m_pipe[0] == -1 && not InetSocket::createPipe()) {
+        return 0;
+    }
+
+    uint64_t bytes_received = 0;
+
+    while (bytes_received < p_size) {
+        auto status = ::splice(m_socket, nullptr, m_pipe[1], nullptr, std::min(p_size - bytes_received, m_pipe_capacity), SPLICE_F_MOVE);
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, m_non_blocking));
+            break;
+        }
+        if (status == 0) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_EOF);
+            break;
+        }
+        auto bytes_in_pipe = static_cast< uint64_t >(status);
+        while (bytes_in_pipe > 0) {
+            auto written = ::splice(m_pipe[0], nullptr, p_file_descriptor, nullptr, bytes_in_pipe, SPLICE_F_MOVE);
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written <= 0) {
+                // Data which is left in the pipe can not be delivered to the file, so the pipe is discarded
+                InetSocket::closePipe();
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::FILE_TRANSFER_IO_ERROR);
+                return bytes_received;
+            }
+            bytes_in_pipe -= static_cast< uint64_t >(written);
+            bytes_received += static_cast< uint64_t >(written);
+        }
+    }
+    return bytes_received;
+}
+
+auto tristan::sockets::InetSocket::writeTo(std::span< const uint8_t > p_data, const Endpoint& p_endpoint) -> uint64_t {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (m_type != tristan::sockets::SocketType::DATA) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::ENDPOINT_NOT_DATAGRAM_SOCKET);
+        return 0;
+    }
+    auto bytes_sent = ::sendto(m_socket, p_data.data(), p_data.size(), MSG_NOSIGNAL, p_endpoint.address(), p_endpoint.length());
+    if (bytes_sent < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::writeErrorFromErrno(errno, m_non_blocking));
+        return 0;
+    }
+    return static_cast< uint64_t >(bytes_sent);
+}
+
+auto tristan::sockets::InetSocket::readFrom(std::span< uint8_t > p_buffer) -> std::pair< uint64_t, Endpoint > {
+
+    std::pair< uint64_t, Endpoint > result{0, {}};
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return result;
+    }
+    if (m_type != tristan::sockets::SocketType::DATA) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::ENDPOINT_NOT_DATAGRAM_SOCKET);
+        return result;
+    }
+    socklen_t address_length = sizeof(result.second.m_address);
+    int64_t status;
+    do {
+        status = ::recvfrom(m_socket,
+                            p_buffer.data(),
+                            p_buffer.size(),
+                            0,
+                            reinterpret_cast< struct sockaddr* >(result.second.m_address.data()),
+                            &address_length);
+    } while (status < 0 && errno == EINTR);
+    if (status < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, m_non_blocking));
+        return result;
+    }
+    result.first = static_cast< uint64_t >(status);
+    result.second.m_length = address_length;
+    return result;
+}
+
+auto tristan::sockets::InetSocket::readBatch(std::span< InetDatagram > p_datagrams) -> uint64_t {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (m_type != tristan::sockets::SocketType::DATA) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::BATCH_NOT_DATAGRAM_SOCKET);
+        return 0;
+    }
+
+    std::array< mmsghdr, g_datagram_batch_size > messages;
+    std::array< iovec, g_datagram_batch_size > vectors;
+    std::array< sockaddr_in, g_datagram_batch_size > addresses;
+    std::array< ControlBuffer, g_datagram_batch_size > controls;
+
+    uint64_t received = 0;
+
+    while (received < p_datagrams.size()) {
+        auto count = static_cast< uint32_t >(std::min< uint64_t >(p_datagrams.size() - received, g_datagram_batch_size));
+        for (uint32_t i = 0; i < count; ++i) {
+            auto& datagram = p_datagrams[received + i];
+            vectors[i] = {datagram.buffer.data(), datagram.buffer.size()};
+            messages[i] = {};
+            messages[i].msg_hdr.msg_name = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+            if (m_receive_offload) {
+                messages[i].msg_hdr.msg_control = controls[i].data;
+                messages[i].msg_hdr.msg_controllen = sizeof(controls[i].data);
+            }
+        }
+        auto status = ::recvmmsg(m_socket, messages.data(), count, received == 0 ? MSG_WAITFORONE : MSG_DONTWAIT, nullptr);
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (received == 0) {
+                m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, m_non_blocking));
+            }
+            break;
+        }
+        for (int32_t i = 0; i < status; ++i) {
+            auto& datagram = p_datagrams[received + static_cast< uint64_t >(i)];
+            datagram.size = messages[i].msg_len;
+            datagram.ip = addresses[i].sin_addr.s_addr;
+            datagram.port = addresses[i].sin_port;
+            datagram.truncated = (messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+            datagram.segment_size = 0;
+            for (auto* control = CMSG_FIRSTHDR(&messages[i].msg_hdr); control != nullptr; control = CMSG_NXTHDR(&messages[i].msg_hdr, control)) {
+                if (control->cmsg_level == IPPROTO_UDP && control->cmsg_type == UDP_GRO) {
+                    int32_t segment_size = 0;
+                    std::memcpy(&segment_size, CMSG_DATA(control), sizeof(segment_size));
+                    if (static_cast< uint64_t >(segment_size) < datagram.size) {
+                        datagram.segment_size = static_cast< uint16_t >(segment_size);
+                    }
+                }
+            }
+        }
+        received += static_cast< uint64_t >(status);
+        if (static_cast< uint32_t >(status) < count) {
+            break;
+        }
+    }
+    return received;
+}
+
+auto tristan::sockets::InetSocket::writeBatch(std::span< const InetDatagram > p_datagrams) -> uint64_t {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (m_type != tristan::sockets::SocketType::DATA) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::BATCH_NOT_DATAGRAM_SOCKET);
+        return 0;
+    }
+
+    std::array< mmsghdr, g_datagram_batch_size > messages;
+    std::array< iovec, g_datagram_batch_size > vectors;
+    std::array< sockaddr_in, g_datagram_batch_size > addresses;
+    std::array< ControlBuffer, g_datagram_batch_size > controls;
+    std::array< std::pair< uint64_t, uint64_t >, g_datagram_batch_size > resume_points;
+
+    uint64_t sent = 0;
+    // Segmented datagram which was cut short by the previous call is resumed after the segments already sent
+    uint64_t offset = not p_datagrams.empty() && m_batch_offset < p_datagrams.front().payload().size() ? m_batch_offset : 0;
+
+    while (sent < p_datagrams.size()) {
+        uint32_t count = 0;
+        bool segmented = false;
+        for (uint64_t index = sent, position = offset; count < g_datagram_batch_size && index < p_datagrams.size(); ++count) {
+            const auto& datagram = p_datagrams[index];
+            auto payload = datagram.payload();
+            auto length = payload.size() - position;
+            bool segment = false;
+            if (datagram.segment_size != 0 && length > datagram.segment_size) {
+                if (m_segmentation_offload) {
+                    auto segments = std::min(g_max_gso_segments, g_max_udp_payload / datagram.segment_size);
+                    length = std::min< uint64_t >(length, std::max< uint64_t >(segments, 1) * datagram.segment_size);
+                    segment = length > datagram.segment_size;
+                } else {
+                    length = datagram.segment_size;
+                }
+            }
+            vectors[count] = {payload.data() + position, length};
+            messages[count] = {};
+            messages[count].msg_hdr.msg_iov = &vectors[count];
+            messages[count].msg_hdr.msg_iovlen = 1;
+            if (segment) {
+                segmented = true;
+                messages[count].msg_hdr.msg_control = controls[count].data;
+                messages[count].msg_hdr.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+                auto* control = CMSG_FIRSTHDR(&messages[count].msg_hdr);
+                control->cmsg_level = IPPROTO_UDP;
+                control->cmsg_type = UDP_SEGMENT;
+                control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                std::memcpy(CMSG_DATA(control), &datagram.segment_size, sizeof(uint16_t));
+            }
+            position += length;
+            if (position >= payload.size()) {
+                ++index;
+                position = 0;
+            }
+            resume_points[count] = {index, position};
+            if (datagram.ip == 0 && datagram.port == 0 && m_connected) {
+                continue;
+            }
+            addresses[count] = {};
+            addresses[count].sin_family = AF_INET;
+            addresses[count].sin_addr.s_addr = datagram.ip == 0 && datagram.port == 0 ? m_ip : datagram.ip;
+            addresses[count].sin_port = datagram.ip == 0 && datagram.port == 0 ? m_port : datagram.port;
+            messages[count].msg_hdr.msg_name = &addresses[count];
+            messages[count].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        }
+        auto status = ::sendmmsg(m_socket, messages.data(), count, MSG_NOSIGNAL);
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (segmented && errno == EIO) {
+                m_segmentation_offload = false;
+                continue;
+            }
+            m_error = tristan::sockets::makeError(tristan::sockets::utility::writeErrorFromErrno(errno, m_non_blocking));
+            break;
+        }
+        if (status == 0) {
+            break;
+        }
+        std::tie(sent, offset) = resume_points[static_cast< uint32_t >(status) - 1];
+    }
+    m_batch_offset = offset;
+    return sent;
+}
+
+void tristan::sockets::InetSocket::setReceiveOffload(bool p_enable) {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    if (m_type != tristan::sockets::SocketType::DATA) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::BATCH_NOT_DATAGRAM_SOCKET);
+        return;
+    }
+    int32_t enable = p_enable ? 1 : 0;
+    auto status = ::setsockopt(m_socket, IPPROTO_UDP, UDP_GRO, &enable, sizeof(enable));
+    m_receive_offload = p_enable && status == 0;
+}
+
+auto tristan::sockets::InetSocket::receiveOffload() const noexcept -> bool { return m_receive_offload; }
+
+auto tristan::sockets::InetSocket::segmentationOffload() const noexcept -> bool { return m_segmentation_offload; }
+
+auto tristan::sockets::InetSocket::notSentSize() const -> uint64_t {
+    int32_t size = 0;
+    if (m_socket == -1 || ::ioctl(m_socket, SIOCOUTQNSD, &size) < 0) {
+        return 0;
+    }
+    return static_cast< uint64_t >(size);
+}
+
+void tristan::sockets::InetSocket::setZeroCopy(bool p_enable, uint64_t p_threshold) {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    m_zero_copy_threshold = p_threshold;
+    if (p_enable == m_zero_copy) {
+        return;
+    }
+    if (not p_enable) {
+        m_zero_copy = false;
+        return;
+    }
+    int32_t enable = 1;
+    m_zero_copy = ::setsockopt(m_socket, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) == 0;
+}
+
+auto tristan::sockets::InetSocket::zeroCopy() const noexcept -> bool { return m_zero_copy; }
+
+auto tristan::sockets::InetSocket::writeZeroCopy(std::span< const uint8_t > p_data, std::function< void() > p_on_complete) -> uint64_t {
+
+    if (not m_zero_copy || m_ssl || not m_connected || p_data.size() < m_zero_copy_threshold) {
+        auto bytes_sent = InetSocket::writeBytes(p_data.data(), p_data.size());
+        if (p_on_complete) {
+            p_on_complete();
+        }
+        return bytes_sent;
+    }
+    if (not m_zero_copy_writes.empty()) {
+        InetSocket::pollZeroCopy();
+    }
+
+    uint64_t bytes_sent = 0;
+    bool zero_copy_used = false;
+    auto first_id = m_zero_copy_next_id;
+
+    while (bytes_sent < p_data.size()) {
+        auto status = ::send(m_socket, p_data.data() + bytes_sent, p_data.size() - bytes_sent, MSG_NOSIGNAL | MSG_ZEROCOPY);
+        if (status < 0 && errno == ENOBUFS) {
+            status = ::send(m_socket, p_data.data() + bytes_sent, p_data.size() - bytes_sent, MSG_NOSIGNAL);
+        } else if (status >= 0) {
+            ++m_zero_copy_next_id;
+            zero_copy_used = true;
+        }
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            m_error = tristan::sockets::makeError(tristan::sockets::utility::writeErrorFromErrno(errno, m_non_blocking));
+            break;
+        }
+        bytes_sent += static_cast< uint64_t >(status);
+    }
+    if (zero_copy_used) {
+        m_zero_copy_writes.push_back({first_id, m_zero_copy_next_id - 1, std::move(p_on_complete)});
+    } else if (p_on_complete) {
+        p_on_complete();
+    }
+    return bytes_sent;
+}
+
+auto tristan::sockets::InetSocket::pollZeroCopy(std::chrono::milliseconds p_timeout) -> uint64_t {
+
+    if (m_zero_copy_writes.empty()) {
+        return 0;
+    }
+    if (p_timeout.count() > 0) {
+        pollfd descriptor{m_socket, 0, 0};
+        ::poll(&descriptor, 1, static_cast< int32_t >(p_timeout.count()));
+    }
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in))];
+
+    while (true) {
+        msghdr message{};
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        if (::recvmsg(m_socket, &message, MSG_ERRQUEUE | MSG_DONTWAIT) < 0) {
+            break;
+        }
+        for (auto* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header)) {
+            if (header->cmsg_level != SOL_IP || header->cmsg_type != IP_RECVERR) {
+                continue;
+            }
+            sock_extended_err notification{};
+            std::memcpy(&notification, CMSG_DATA(header), sizeof(notification));
+            if (notification.ee_origin != SO_EE_ORIGIN_ZEROCOPY || notification.ee_errno != 0) {
+                continue;
+            }
+            if ((notification.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0) {
+                m_zero_copy_copied += notification.ee_data - notification.ee_info + 1;
+            }
+            if (not zeroCopyIdBefore(notification.ee_data, m_zero_copy_completed_id)) {
+                m_zero_copy_completed_ranges.emplace_back(notification.ee_info, notification.ee_data);
+            }
+        }
+    }
+
+    // Kernel does not promise to report ranges in order, so completed id only advances over ranges which close the gap
+    bool advanced = true;
+    while (advanced) {
+        advanced = false;
+        for (auto range = m_zero_copy_completed_ranges.begin(); range != m_zero_copy_completed_ranges.end(); ++range) {
+            if (zeroCopyIdBefore(m_zero_copy_completed_id, range->first)) {
+                continue;
+            }
+            if (not zeroCopyIdBefore(range->second, m_zero_copy_completed_id)) {
+                m_zero_copy_completed_id = range->second + 1;
+            }
+            m_zero_copy_completed_ranges.erase(range);
+            advanced = true;
+            break;
+        }
+    }
+
+    std::vector< std::function< void() > > callbacks;
+    for (auto zero_copy_write = m_zero_copy_writes.begin(); zero_copy_write != m_zero_copy_writes.end();) {
+        bool completed = zeroCopyIdBefore(zero_copy_write->last_id, m_zero_copy_completed_id)
+                      || std::any_of(m_zero_copy_completed_ranges.begin(), m_zero_copy_completed_ranges.end(), [zero_copy_write](const auto& range) {
+                             return not zeroCopyIdBefore(zero_copy_write->first_id, range.first) && not zeroCopyIdBefore(range.second, zero_copy_write->last_id);
+                         });
+        if (not completed) {
+            ++zero_copy_write;
+            continue;
+        }
+        callbacks.push_back(std::move(zero_copy_write->on_complete));
+        zero_copy_write = m_zero_copy_writes.erase(zero_copy_write);
+    }
+    // Callbacks are called after bookkeeping is done, since they may write again
+    for (auto& callback: callbacks) {
+        if (callback) {
+            callback();
+        }
+    }
+    return callbacks.size();
+}
+
+auto tristan::sockets::InetSocket::pendingZeroCopyWrites() const noexcept -> uint64_t { return m_zero_copy_writes.size(); }
+
+void tristan::sockets::InetSocket::drainZeroCopy() {
+    // Notifications are lost once socket is closed, so kernel is given time to release data sent to a slow peer first.
+    // Disconnect drops send queue, after which the rest of pages is released without waiting for the peer
+    auto deadline = std::chrono::steady_clock::now() + (m_options.abortive_close.value_or(false) ? std::chrono::milliseconds(0) : g_zero_copy_close_timeout);
+    bool disconnected = false;
+    while (not m_zero_copy_writes.empty()) {
+        auto left = std::chrono::ceil< std::chrono::milliseconds >(deadline - std::chrono::steady_clock::now());
+        if (left.count() > 0) {
+            InetSocket::pollZeroCopy(left);
+            continue;
+        }
+        if (disconnected) {
+            break;
+        }
+        sockaddr unspecified{};
+        unspecified.sa_family = AF_UNSPEC;
+        ::connect(m_socket, &unspecified, sizeof(unspecified));
+        disconnected = true;
+        deadline = std::chrono::steady_clock::now() + g_zero_copy_disconnect_timeout;
+    }
+}
+
+auto tristan::sockets::InetSocket::zeroCopyCopiedCount() const noexcept -> uint64_t { return m_zero_copy_copied; }
+
+void tristan::sockets::InetSocket::setMemoryResource(std::pmr::memory_resource* p_resource) noexcept {
+    m_memory_resource = p_resource == nullptr ? std::pmr::get_default_resource() : p_resource;
+}
+
+auto tristan::sockets::InetSocket::memoryResource() const noexcept -> std::pmr::memory_resource* { return m_memory_resource; }
+
+auto tristan::sockets::InetSocket::writeBytes(const uint8_t* p_data, uint64_t p_size) -> uint64_t {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (p_size == 0) {
+        return 0;
+    }
+
+    int64_t bytes_sent = 0;
+
+    if (m_connected) {
+        if (m_ssl) {
+            auto ssl_write_result = m_ssl->write(p_data, p_size);
+            if (ssl_write_result.first && ssl_write_result.first.value() == static_cast< int >(tristan::sockets::Error::SSL_TRY_AGAIN)) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::WRITE_TRY_AGAIN);
+            } else {
+                m_error = ssl_write_result.first;
+            }
+            return ssl_write_result.second;
+        }
+        bytes_sent = ::send(m_socket, p_data, p_size, MSG_NOSIGNAL);
+    } else {
+        if (m_type == tristan::sockets::SocketType::STREAM) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_CONNECTED);
+            return 0;
+        }
+        bytes_sent = ::sendto(m_socket, p_data, p_size, MSG_NOSIGNAL, m_remote_endpoint.address(), m_remote_endpoint.length());
+    }
+    if (bytes_sent < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::writeErrorFromErrno(errno, m_non_blocking));
+        return 0;
+    }
+    return static_cast< uint64_t >(bytes_sent);
+}
+
+auto tristan::sockets::InetSocket::readBytes(uint8_t* p_data, uint64_t p_size) -> uint64_t {
+
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+
+    uint64_t bytes_read = 0;
+
+    while (bytes_read < p_size) {
+        if (m_ssl) {
+            auto ssl_read_status = m_ssl->read(p_data + bytes_read, p_size - bytes_read);
+            bytes_read += ssl_read_status.second;
+            if (ssl_read_status.first) {
+                if (ssl_read_status.first.value() == static_cast< int >(tristan::sockets::Error::SSL_TRY_AGAIN)) {
+                    m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_TRY_AGAIN);
+                } else {
+                    m_error = ssl_read_status.first;
+                }
+                break;
+            }
+            continue;
+        }
+        auto status = ::recv(m_socket, p_data + bytes_read, p_size - bytes_read, m_non_blocking ? 0 : MSG_WAITALL);
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, m_non_blocking));
+            break;
+        }
+        if (status == 0) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_EOF);
+            break;
+        }
+        bytes_read += static_cast< uint64_t >(status);
+    }
+    InetSocket::rearmQuickAck(bytes_read);
+    return bytes_read;
+}
+
+auto tristan::sockets::InetSocket::createPipe() -> bool {
+
+    if (::pipe2(m_pipe.data(), O_CLOEXEC) < 0) {
+        m_pipe = {-1, -1};
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::FILE_TRANSFER_PIPE_ERROR);
+        return false;
+    }
+    ::fcntl(m_pipe[1], F_SETPIPE_SZ, 1024 * 1024);
+    auto capacity = ::fcntl(m_pipe[1], F_GETPIPE_SZ);
+    m_pipe_capacity = capacity > 0 ? static_cast< uint64_t >(capacity) : 64 * 1024;
+    return true;
+}
+
+void tristan::sockets::InetSocket::rearmQuickAck(uint64_t p_bytes_read) {
+    // Kernel leaves quick ack mode after acknowledging received data, so it is set again once per read call which received something
+    if (m_quick_ack && p_bytes_read > 0) {
+        setOption(m_socket, IPPROTO_TCP, TCP_QUICKACK, 1);
+    }
+}
+
+void tristan::sockets::InetSocket::closePipe() {
+
+    if (m_pipe[0] != -1) {
+        ::close(m_pipe[0]);
+        ::close(m_pipe[1]);
+        m_pipe = {-1, -1};
+    }
+}
+
 auto tristan::sockets::InetSocket::ip() const noexcept -> uint32_t { return m_ip; }
 
 auto tristan::sockets::InetSocket::port() const noexcept -> uint16_t { return m_port; }
 
+auto tristan::sockets::InetSocket::remoteEndpoint() const noexcept -> const Endpoint& { return m_remote_endpoint; }
+
+auto tristan::sockets::InetSocket::options() const noexcept -> const SocketOptions& { return m_options; }
+
+auto tristan::sockets::InetSocket::failedOptions() const noexcept -> const std::vector< SocketOption >& { return m_failed_options; }
+
 auto tristan::sockets::InetSocket::error() const noexcept -> std::error_code { return m_error; }
 
 auto tristan::sockets::InetSocket::nonBlocking() const noexcept -> bool { return m_non_blocking; }
 
 auto tristan::sockets::InetSocket::connected() const noexcept -> bool { return m_connected; }
 
+auto tristan::sockets::InetSocket::nativeHandle() const noexcept -> int32_t { return m_socket; }
+
+auto tristan::sockets::InetSocket::incomingCpu() const -> int32_t {
+    int32_t cpu = -1;
+    socklen_t cpu_length = sizeof(cpu);
+    if (m_socket == -1 || ::getsockopt(m_socket, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &cpu_length) < 0) {
+        return -1;
+    }
+    return cpu;
+}
+
+auto tristan::sockets::InetSocket::localEndpoint() const -> tristan::sockets::Endpoint {
+    tristan::sockets::Endpoint endpoint;
+    socklen_t length = endpoint.m_address.size();
+    if (m_socket == -1 || ::getsockname(m_socket, reinterpret_cast< struct sockaddr* >(endpoint.m_address.data()), &length) < 0) {
+        return {};
+    }
+    endpoint.m_length = length;
+    return endpoint;
+}
+
+auto tristan::sockets::InetSocket::encrypted() const noexcept -> bool { return static_cast< bool >(m_ssl); }
+
 tristan::sockets::InetSocket::InetSocket(bool) :
     m_socket(-1),
     m_ip(0),
+    m_memory_resource(std::pmr::get_default_resource()),
     m_port(0),
+    m_zero_copy_threshold(16 * 1024),
+    m_zero_copy_copied(0),
+    m_zero_copy_next_id(0),
+    m_zero_copy_completed_id(0),
+    m_pipe{-1, -1},
+    m_pipe_capacity(0),
+    m_batch_offset(0),
     m_type(tristan::sockets::SocketType::STREAM),
     m_non_blocking(false),
     m_bound(false),
     m_listening(false),
     m_not_ssl_connected(false),
-    m_connected(false) { }
+    m_connected(false),
+    m_segmentation_offload(false),
+    m_receive_offload(false),
+    m_zero_copy(false),
+    m_quick_ack(false) { }
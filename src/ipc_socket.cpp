@@ -1,12 +1,26 @@
 #include "ipc_socket.hpp"
 #include "socket_error.hpp"
+#include "socket_error_utility.hpp"
 
 #include <sys/socket.h>
 #include <sys/fcntl.h>
 #include <sys/un.h>
 #include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+namespace {
+    /**
+     * \brief Maximum number of datagrams passed to single recvmmsg or sendmmsg call
+     */
+    constexpr uint32_t g_datagram_batch_size = 64;
+}  // namespace
 
 tristan::sockets::IpcSocket::IpcSocket(SocketType p_socket_type) :
+    m_memory_resource(std::pmr::get_default_resource()),
     m_socket(-1),
     m_type(p_socket_type),
     m_global_namespace(false),
@@ -68,6 +82,11 @@ void tristan::sockets::IpcSocket::setPeerName(const std::string& p_name, bool p_
         m_peer_name = "#";
     }
     m_peer_name += p_name;
+    if (m_peer_global_namespace) {
+        m_peer_endpoint = tristan::sockets::Endpoint::ipc(std::string_view(m_peer_name).substr(1), true);
+    } else {
+        m_peer_endpoint = tristan::sockets::Endpoint::ipc(m_peer_name);
+    }
 }
 
 void tristan::sockets::IpcSocket::setNonBlocking(bool p_non_blocking) {
@@ -88,6 +107,57 @@ void tristan::sockets::IpcSocket::setNonBlocking(bool p_non_blocking) {
     m_non_blocking = p_non_blocking;
 }
 
+void tristan::sockets::IpcSocket::setReceiveLowWatermark(uint32_t p_bytes) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    auto low_watermark = static_cast< int32_t >(std::clamp< uint32_t >(p_bytes, 1, std::numeric_limits< int32_t >::max()));
+    if (::setsockopt(m_socket, SOL_SOCKET, SO_RCVLOWAT, &low_watermark, sizeof(low_watermark)) < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+void tristan::sockets::IpcSocket::setSendBufferSize(uint32_t p_bytes) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    auto size = static_cast< int32_t >(std::min< uint32_t >(p_bytes, std::numeric_limits< int32_t >::max()));
+    if (::setsockopt(m_socket, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size)) < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+void tristan::sockets::IpcSocket::setReceiveBufferSize(uint32_t p_bytes) {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    auto size = static_cast< int32_t >(std::min< uint32_t >(p_bytes, std::numeric_limits< int32_t >::max()));
+    if (::setsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)) < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_SET_OPTION_ERROR);
+    }
+}
+
+auto tristan::sockets::IpcSocket::sendBufferSize() const -> uint32_t {
+    int32_t size = 0;
+    socklen_t size_length = sizeof(size);
+    if (m_socket == -1 || ::getsockopt(m_socket, SOL_SOCKET, SO_SNDBUF, &size, &size_length) < 0) {
+        return 0;
+    }
+    return static_cast< uint32_t >(size);
+}
+
+auto tristan::sockets::IpcSocket::receiveBufferSize() const -> uint32_t {
+    int32_t size = 0;
+    socklen_t size_length = sizeof(size);
+    if (m_socket == -1 || ::getsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &size, &size_length) < 0) {
+        return 0;
+    }
+    return static_cast< uint32_t >(size);
+}
+
 void tristan::sockets::IpcSocket::resetError() { m_error = tristan::sockets::makeError(tristan::sockets::Error::SUCCESS); }
 
 void tristan::sockets::IpcSocket::bind() {
@@ -98,14 +168,12 @@ void tristan::sockets::IpcSocket::bind() {
     if (m_bound) {
         return;
     }
-    sockaddr_un address{};
-    address.sun_family = AF_UNIX;
-    strcpy(address.sun_path, m_name.c_str());
-    if (m_name.at(0) == '#') {
-        address.sun_path[0] = 0;
+    auto endpoint = m_global_namespace ? tristan::sockets::Endpoint::ipc(std::string_view(m_name).substr(1), true) : tristan::sockets::Endpoint::ipc(m_name);
+    if (endpoint.empty()) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::BIND_NAME_TO_LONG);
+        return;
     }
-    auto address_length = sizeof(address.sun_family) + m_name.size();
-    auto status = ::bind(m_socket, reinterpret_cast< const struct sockaddr* >(&address), address_length);
+    auto status = ::bind(m_socket, endpoint.address(), endpoint.length());
     if (status < 0) {
         tristan::sockets::Error error{};
         switch (errno) {
@@ -218,14 +286,7 @@ void tristan::sockets::IpcSocket::connect() {
         return;
     }
     if (not m_connected) {
-        sockaddr_un peer_address{};
-        peer_address.sun_family = AF_UNIX;
-        strcpy(peer_address.sun_path, m_peer_name.c_str());
-        if (m_peer_name.at(0) == '#') {
-            peer_address.sun_path[0] = 0;
-        }
-        auto address_length = sizeof(peer_address.sun_family) + m_peer_name.size();
-        auto status = ::connect(m_socket, reinterpret_cast< struct sockaddr* >(&peer_address), address_length);
+        auto status = ::connect(m_socket, m_peer_endpoint.address(), m_peer_endpoint.length());
         if (status < 0) {
             tristan::sockets::Error error{};
             switch (errno) {
@@ -463,6 +524,7 @@ auto tristan::sockets::IpcSocket::accept() -> std::optional< std::unique_ptr< Ip
     } else {
         socket->m_peer_name = std::string(peer_address.sun_path);
     }
+    socket->m_memory_resource = m_memory_resource;
     socket->m_connected = true;
     socket->m_global_namespace = m_global_namespace;
     return socket;
@@ -483,14 +545,7 @@ auto tristan::sockets::IpcSocket::write(uint8_t p_byte) -> uint8_t {
         if (m_type == tristan::sockets::SocketType::STREAM) {
             m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_CONNECTED);
         } else {
-            sockaddr_un peer_address{};
-            peer_address.sun_family = AF_UNIX;
-            strcpy(peer_address.sun_path, m_peer_name.c_str());
-            if (m_peer_name.at(0) == '#') {
-                peer_address.sun_path[0] = 0;
-            }
-            auto address_length = sizeof(peer_address.sun_family) + m_peer_name.size();
-            bytes_sent = ::sendto(m_socket, &p_byte, 1, MSG_NOSIGNAL, reinterpret_cast< struct sockaddr* >(&peer_address), address_length);
+            bytes_sent = ::sendto(m_socket, &p_byte, 1, MSG_NOSIGNAL, m_peer_endpoint.address(), m_peer_endpoint.length());
         }
     }
     if (static_cast< int8_t >(bytes_sent) < 0) {
@@ -585,105 +640,8 @@ auto tristan::sockets::IpcSocket::write(const std::vector< uint8_t >& p_data, ui
         return 0;
     }
 
-    uint64_t bytes_sent = 0;
     uint64_t l_size = (p_size == 0 ? p_data.size() : p_size);
-    if (m_connected) {
-        bytes_sent = ::send(m_socket, p_data.data() + p_offset, l_size, MSG_NOSIGNAL);
-    } else {
-        if (m_type == tristan::sockets::SocketType::STREAM) {
-            m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_CONNECTED);
-        } else {
-            sockaddr_un peer_address{};
-            peer_address.sun_family = AF_UNIX;
-            strcpy(peer_address.sun_path, m_peer_name.c_str());
-            if (m_peer_name.at(0) == '#') {
-                peer_address.sun_path[0] = 0;
-            }
-            auto address_length = sizeof(peer_address.sun_family) + m_peer_name.size();
-            bytes_sent = ::sendto(m_socket, p_data.data() + p_offset, l_size, MSG_NOSIGNAL, reinterpret_cast< struct sockaddr* >(&peer_address), address_length);
-        }
-    }
-    if (static_cast< int8_t >(bytes_sent) < 0) {
-        tristan::sockets::Error error{};
-        switch (errno) {
-            case EACCES: {
-                error = tristan::sockets::Error::WRITE_ACCESS;
-                break;
-            }
-            case EAGAIN: {
-                error = tristan::sockets::Error::WRITE_TRY_AGAIN;
-                break;
-            }
-#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
-            case EWOULDBLOCK: {
-                error = tristan::sockets::Error::WRITE_TRY_AGAIN;
-                break;
-            }
-#endif
-            case EALREADY: {
-                error = tristan::sockets::Error::WRITE_ALREADY;
-                break;
-            }
-            case EBADF: {
-                error = tristan::sockets::Error::WRITE_BAD_FILE_DESCRIPTOR;
-                break;
-            }
-            case ECONNRESET: {
-                error = tristan::sockets::Error::WRITE_CONNECTION_RESET;
-                break;
-            }
-            case EDESTADDRREQ: {
-                error = tristan::sockets::Error::WRITE_DESTINATION_ADDRESS;
-                break;
-            }
-            case EFAULT: {
-                error = tristan::sockets::Error::WRITE_BUFFER_OUT_OF_RANGE;
-                break;
-            }
-            case EINTR: {
-                error = tristan::sockets::Error::WRITE_INTERRUPTED;
-                break;
-            }
-            case EINVAL: {
-                error = tristan::sockets::Error::WRITE_INVALID_ARGUMENT;
-                break;
-            }
-            case EISCONN: {
-                error = tristan::sockets::Error::WRITE_IS_CONNECTED;
-                break;
-            }
-            case EMSGSIZE: {
-                error = tristan::sockets::Error::WRITE_MESSAGE_SIZE;
-                break;
-            }
-            case ENOBUFS: {
-                error = tristan::sockets::Error::WRITE_NO_BUFFER;
-                break;
-            }
-            case ENOMEM: {
-                error = tristan::sockets::Error::WRITE_NO_MEMORY;
-                break;
-            }
-            case ENOTCONN: {
-                error = tristan::sockets::Error::WRITE_NOT_CONNECTED;
-                break;
-            }
-            case ENOTSOCK: {
-                error = tristan::sockets::Error::WRITE_NOT_SOCKET;
-                break;
-            }
-            case EOPNOTSUPP: {
-                error = tristan::sockets::Error::WRITE_NOT_SUPPORTED;
-                break;
-            }
-            case EPIPE: {
-                error = tristan::sockets::Error::WRITE_PIPE;
-                break;
-            }
-        }
-        m_error = tristan::sockets::makeError(error);
-    }
-    return bytes_sent;
+    return IpcSocket::writeBytes(p_data.data() + p_offset, l_size);
 }
 
 auto tristan::sockets::IpcSocket::read() -> uint8_t {
@@ -826,6 +784,26 @@ auto tristan::sockets::IpcSocket::read(uint16_t p_size) -> std::vector< uint8_t
     return data;
 }
 
+auto tristan::sockets::IpcSocket::readSome(std::span< uint8_t > p_buffer) -> uint64_t {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (p_buffer.empty()) {
+        return 0;
+    }
+
+    auto status = ::recv(m_socket, p_buffer.data(), p_buffer.size(), 0);
+    if (status < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, m_non_blocking));
+        return 0;
+    }
+    if (status == 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_EOF);
+    }
+    return static_cast< uint64_t >(status);
+}
+
 auto tristan::sockets::IpcSocket::readUntil(uint8_t p_delimiter) -> std::vector< uint8_t > {
     std::vector< uint8_t > data;
 
@@ -876,17 +854,283 @@ auto tristan::sockets::IpcSocket::readUntil(const std::vector< uint8_t >& p_deli
     return data;
 }
 
+auto tristan::sockets::IpcSocket::read(uint16_t p_size, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t > {
+
+    std::pmr::vector< uint8_t > data(p_resource == nullptr ? m_memory_resource : p_resource);
+
+    if (p_size == 0) {
+        return data;
+    }
+
+    data.resize(p_size);
+    data.resize(IpcSocket::readSome(data));
+    return data;
+}
+
+auto tristan::sockets::IpcSocket::readUntil(uint8_t p_delimiter, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t > {
+
+    return IpcSocket::readUntil(std::span< const uint8_t >(&p_delimiter, 1), p_resource);
+}
+
+auto tristan::sockets::IpcSocket::readUntil(std::span< const uint8_t > p_delimiter, std::pmr::memory_resource* p_resource) -> std::pmr::vector< uint8_t > {
+
+    std::pmr::vector< uint8_t > data(p_resource == nullptr ? m_memory_resource : p_resource);
+
+    if (p_delimiter.empty()) {
+        return data;
+    }
+
+    uint8_t byte = 0;
+    while (IpcSocket::readSome({&byte, 1}) == 1) {
+        data.push_back(byte);
+        if (data.size() >= p_delimiter.size() && std::equal(p_delimiter.begin(), p_delimiter.end(), data.end() - static_cast< int64_t >(p_delimiter.size()))) {
+            data.resize(data.size() - p_delimiter.size());
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_DONE);
+            break;
+        }
+    }
+    return data;
+}
+
+auto tristan::sockets::IpcSocket::writeTo(std::span< const uint8_t > p_data, const Endpoint& p_endpoint) -> uint64_t {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (m_type != tristan::sockets::SocketType::DATA) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::ENDPOINT_NOT_DATAGRAM_SOCKET);
+        return 0;
+    }
+    auto bytes_sent = ::sendto(m_socket, p_data.data(), p_data.size(), MSG_NOSIGNAL, p_endpoint.address(), p_endpoint.length());
+    if (bytes_sent < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::writeErrorFromErrno(errno, m_non_blocking));
+        return 0;
+    }
+    return static_cast< uint64_t >(bytes_sent);
+}
+
+auto tristan::sockets::IpcSocket::readFrom(std::span< uint8_t > p_buffer) -> std::pair< uint64_t, Endpoint > {
+    std::pair< uint64_t, Endpoint > result{0, {}};
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return result;
+    }
+    if (m_type != tristan::sockets::SocketType::DATA) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::ENDPOINT_NOT_DATAGRAM_SOCKET);
+        return result;
+    }
+    socklen_t address_length = sizeof(result.second.m_address);
+    int64_t status;
+    do {
+        status = ::recvfrom(m_socket,
+                            p_buffer.data(),
+                            p_buffer.size(),
+                            0,
+                            reinterpret_cast< struct sockaddr* >(result.second.m_address.data()),
+                            &address_length);
+    } while (status < 0 && errno == EINTR);
+    if (status < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, m_non_blocking));
+        return result;
+    }
+    result.first = static_cast< uint64_t >(status);
+    result.second.m_length = address_length;
+    return result;
+}
+
+auto tristan::sockets::IpcSocket::readBatch(std::span< IpcDatagram > p_datagrams) -> uint64_t {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (m_type != tristan::sockets::SocketType::DATA) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::BATCH_NOT_DATAGRAM_SOCKET);
+        return 0;
+    }
+
+    std::array< mmsghdr, g_datagram_batch_size > messages;
+    std::array< iovec, g_datagram_batch_size > vectors;
+    std::array< sockaddr_un, g_datagram_batch_size > addresses;
+
+    uint64_t received = 0;
+
+    while (received < p_datagrams.size()) {
+        auto count = static_cast< uint32_t >(std::min< uint64_t >(p_datagrams.size() - received, g_datagram_batch_size));
+        for (uint32_t i = 0; i < count; ++i) {
+            auto& datagram = p_datagrams[received + i];
+            vectors[i] = {datagram.buffer.data(), datagram.buffer.size()};
+            messages[i] = {};
+            messages[i].msg_hdr.msg_name = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_un);
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+        auto status = ::recvmmsg(m_socket, messages.data(), count, received == 0 ? MSG_WAITFORONE : MSG_DONTWAIT, nullptr);
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (received == 0) {
+                m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, m_non_blocking));
+            }
+            break;
+        }
+        for (int32_t i = 0; i < status; ++i) {
+            auto& datagram = p_datagrams[received + static_cast< uint64_t >(i)];
+            datagram.size = messages[i].msg_len;
+            datagram.truncated = (messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+            auto path_length = messages[i].msg_hdr.msg_namelen > offsetof(sockaddr_un, sun_path) ? messages[i].msg_hdr.msg_namelen - offsetof(sockaddr_un, sun_path) : 0;
+            const char* path = addresses[i].sun_path;
+            datagram.global_namespace = path_length > 0 && path[0] == 0;
+            if (datagram.global_namespace) {
+                datagram.name.assign(path + 1, path_length - 1);
+            } else {
+                datagram.name.assign(path, strnlen(path, path_length));
+            }
+        }
+        received += static_cast< uint64_t >(status);
+        if (static_cast< uint32_t >(status) < count) {
+            break;
+        }
+    }
+    return received;
+}
+
+auto tristan::sockets::IpcSocket::writeBatch(std::span< const IpcDatagram > p_datagrams) -> uint64_t {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (m_type != tristan::sockets::SocketType::DATA) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::BATCH_NOT_DATAGRAM_SOCKET);
+        return 0;
+    }
+
+    std::array< mmsghdr, g_datagram_batch_size > messages;
+    std::array< iovec, g_datagram_batch_size > vectors;
+    std::array< sockaddr_un, g_datagram_batch_size > addresses;
+
+    uint64_t sent = 0;
+
+    while (sent < p_datagrams.size()) {
+        auto count = static_cast< uint32_t >(std::min< uint64_t >(p_datagrams.size() - sent, g_datagram_batch_size));
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto& datagram = p_datagrams[sent + i];
+            vectors[i] = {datagram.buffer.data(), std::min< uint64_t >(datagram.size, datagram.buffer.size())};
+            messages[i] = {};
+            messages[i].msg_hdr.msg_iov = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+            if (datagram.name.empty() && m_connected) {
+                continue;
+            }
+            std::string_view name = datagram.name;
+            bool global_namespace = datagram.global_namespace;
+            if (name.empty()) {
+                name = m_peer_name;
+                global_namespace = not name.empty() && name.front() == '#';
+                if (global_namespace) {
+                    name.remove_prefix(1);
+                }
+            }
+            auto endpoint = tristan::sockets::Endpoint::ipc(name, global_namespace);
+            if (endpoint.empty()) {
+                if (i == 0) {
+                    m_error = tristan::sockets::makeError(tristan::sockets::Error::WRITE_INVALID_ARGUMENT);
+                    return sent;
+                }
+                count = i;
+                break;
+            }
+            std::memcpy(&addresses[i], endpoint.address(), endpoint.length());
+            messages[i].msg_hdr.msg_name = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = endpoint.length();
+        }
+        auto status = ::sendmmsg(m_socket, messages.data(), count, MSG_NOSIGNAL);
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            m_error = tristan::sockets::makeError(tristan::sockets::utility::writeErrorFromErrno(errno, m_non_blocking));
+            break;
+        }
+        sent += static_cast< uint64_t >(status);
+    }
+    return sent;
+}
+
+void tristan::sockets::IpcSocket::setMemoryResource(std::pmr::memory_resource* p_resource) noexcept {
+    m_memory_resource = p_resource == nullptr ? std::pmr::get_default_resource() : p_resource;
+}
+
+auto tristan::sockets::IpcSocket::memoryResource() const noexcept -> std::pmr::memory_resource* { return m_memory_resource; }
+
+auto tristan::sockets::IpcSocket::writeBytes(const uint8_t* p_data, uint64_t p_size) -> uint64_t {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+    if (p_size == 0) {
+        return 0;
+    }
+
+    int64_t bytes_sent = 0;
+    if (m_connected) {
+        bytes_sent = ::send(m_socket, p_data, p_size, MSG_NOSIGNAL);
+    } else {
+        if (m_type == tristan::sockets::SocketType::STREAM) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_CONNECTED);
+            return 0;
+        }
+        bytes_sent = ::sendto(m_socket, p_data, p_size, MSG_NOSIGNAL, m_peer_endpoint.address(), m_peer_endpoint.length());
+    }
+    if (bytes_sent < 0) {
+        m_error = tristan::sockets::makeError(tristan::sockets::utility::writeErrorFromErrno(errno, m_non_blocking));
+        return 0;
+    }
+    return static_cast< uint64_t >(bytes_sent);
+}
+
+auto tristan::sockets::IpcSocket::readBytes(uint8_t* p_data, uint64_t p_size) -> uint64_t {
+    if (m_socket == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return 0;
+    }
+
+    uint64_t bytes_read = 0;
+    while (bytes_read < p_size) {
+        auto status = ::recv(m_socket, p_data + bytes_read, p_size - bytes_read, m_non_blocking ? 0 : MSG_WAITALL);
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, m_non_blocking));
+            break;
+        }
+        if (status == 0) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::READ_EOF);
+            break;
+        }
+        bytes_read += static_cast< uint64_t >(status);
+    }
+    return bytes_read;
+}
+
 auto tristan::sockets::IpcSocket::name() const noexcept -> const std::string& { return m_name; }
 
 auto tristan::sockets::IpcSocket::peerName() const noexcept -> const std::string& { return m_peer_name; }
 
+auto tristan::sockets::IpcSocket::peerEndpoint() const noexcept -> const Endpoint& { return m_peer_endpoint; }
+
 auto tristan::sockets::IpcSocket::error() const noexcept -> std::error_code { return m_error; }
 
 auto tristan::sockets::IpcSocket::nonBlocking() const noexcept -> bool { return m_non_blocking; }
 
 auto tristan::sockets::IpcSocket::connected() const noexcept -> bool { return m_connected; }
 
+auto tristan::sockets::IpcSocket::nativeHandle() const noexcept -> int32_t { return m_socket; }
+
 tristan::sockets::IpcSocket::IpcSocket(bool) :
+    m_memory_resource(std::pmr::get_default_resource()),
     m_socket(-1),
     m_type(tristan::sockets::SocketType::STREAM),
     m_global_namespace(false),
@@ -0,0 +1,92 @@
+#include "request_arena.hpp"
+
+#include <algorithm>
+
+tristan::sockets::RequestArena::RequestArena(uint64_t p_block_size, std::pmr::memory_resource* p_upstream) :
+    m_upstream(p_upstream == nullptr ? std::pmr::new_delete_resource() : p_upstream),
+    m_block_size(std::max< uint64_t >(p_block_size, alignof(std::max_align_t))),
+    m_current_block(0),
+    m_offset(0),
+    m_used(0),
+    m_high_watermark(0),
+    m_upstream_allocations(0) { }
+
+tristan::sockets::RequestArena::~RequestArena() {
+    for (auto& l_block: m_blocks) {
+        m_upstream->deallocate(l_block.data, l_block.size, alignof(std::max_align_t));
+    }
+}
+
+void tristan::sockets::RequestArena::reset() noexcept {
+    m_current_block = 0;
+    m_offset = 0;
+    m_used = 0;
+}
+
+void tristan::sockets::RequestArena::release() noexcept {
+    RequestArena::reset();
+    while (m_blocks.size() > 1) {
+        m_upstream->deallocate(m_blocks.back().data, m_blocks.back().size, alignof(std::max_align_t));
+        m_blocks.pop_back();
+    }
+}
+
+auto tristan::sockets::RequestArena::copy(std::span< const uint8_t > p_data) -> std::span< uint8_t > {
+    if (p_data.empty()) {
+        return {};
+    }
+    auto* l_destination = static_cast< uint8_t* >(RequestArena::allocate(p_data.size(), 1));
+    std::memcpy(l_destination, p_data.data(), p_data.size());
+    return {l_destination, p_data.size()};
+}
+
+auto tristan::sockets::RequestArena::copy(std::string_view p_string) -> std::string_view {
+    auto l_copy = RequestArena::copy(std::span< const uint8_t >(reinterpret_cast< const uint8_t* >(p_string.data()), p_string.size()));
+    return {reinterpret_cast< const char* >(l_copy.data()), l_copy.size()};
+}
+
+auto tristan::sockets::RequestArena::used() const noexcept -> uint64_t { return m_used; }
+
+auto tristan::sockets::RequestArena::capacity() const noexcept -> uint64_t {
+    uint64_t l_capacity = 0;
+    for (const auto& l_block: m_blocks) {
+        l_capacity += l_block.size;
+    }
+    return l_capacity;
+}
+
+auto tristan::sockets::RequestArena::highWatermark() const noexcept -> uint64_t { return m_high_watermark; }
+
+auto tristan::sockets::RequestArena::upstreamAllocations() const noexcept -> uint64_t { return m_upstream_allocations; }
+
+auto tristan::sockets::RequestArena::do_allocate(std::size_t p_bytes, std::size_t p_alignment) -> void* {
+    while (m_current_block < m_blocks.size()) {
+        auto& l_block = m_blocks[m_current_block];
+        auto l_address = reinterpret_cast< uintptr_t >(l_block.data) + m_offset;
+        auto l_padding = (p_alignment - l_address % p_alignment) % p_alignment;
+        if (m_offset + l_padding + p_bytes <= l_block.size) {
+            m_offset += l_padding + p_bytes;
+            m_used += l_padding + p_bytes;
+            m_high_watermark = std::max(m_high_watermark, m_used);
+            return l_block.data + m_offset - p_bytes;
+        }
+        ++m_current_block;
+        m_offset = 0;
+    }
+    RequestArena::addBlock(p_bytes + p_alignment);
+    return RequestArena::do_allocate(p_bytes, p_alignment);
+}
+
+void tristan::sockets::RequestArena::do_deallocate([[maybe_unused]] void* p_pointer, [[maybe_unused]] std::size_t p_bytes, [[maybe_unused]] std::size_t p_alignment) { }
+
+auto tristan::sockets::RequestArena::do_is_equal(const std::pmr::memory_resource& p_other) const noexcept -> bool { return this == &p_other; }
+
+void tristan::sockets::RequestArena::addBlock(uint64_t p_minimum_size) {
+    auto l_size = m_blocks.empty() ? m_block_size : m_blocks.back().size * 2;
+    l_size = std::max(l_size, p_minimum_size);
+    auto* l_data = static_cast< std::byte* >(m_upstream->allocate(l_size, alignof(std::max_align_t)));
+    m_blocks.push_back({l_data, l_size});
+    ++m_upstream_allocations;
+    m_current_block = m_blocks.size() - 1;
+    m_offset = 0;
+}
@@ -0,0 +1,145 @@
+#include "reuseport_group.hpp"
+
+#include <linux/filter.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <thread>
+
+tristan::sockets::ReuseportGroup::ReuseportGroup(uint32_t p_ip, uint16_t p_port, uint32_t p_listener_count, uint32_t p_connection_count_limit, SocketOptions p_options) :
+    m_misrouted(0),
+    m_steering(false) {
+    p_options.reuse_port = true;
+    auto l_listener_count = p_listener_count > 0 ? p_listener_count : std::max(std::thread::hardware_concurrency(), 1U);
+    // Kernel numbers sockets of the group in the order they start listening, which is the order listeners are indexed
+    for (uint32_t i = 0; i < l_listener_count; ++i) {
+        auto l_listener = std::make_unique< InetSocket >(SocketType::STREAM, p_options);
+        if (not l_listener->error()) {
+            l_listener->setHost(p_ip);
+            l_listener->setPort(p_port);
+            l_listener->bind();
+        }
+        if (not l_listener->error()) {
+            l_listener->listen(p_connection_count_limit);
+        }
+        if (l_listener->error()) {
+            m_error = l_listener->error();
+            return;
+        }
+        m_listeners.push_back(std::move(l_listener));
+        m_handoffs.push_back(std::make_unique< Handoff >());
+        m_handoffs.back()->event = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    }
+    // Program is shared by the whole group, it is attached once all listeners exist so modulus is the final listener count
+    ReuseportGroup::attachProgram();
+}
+
+tristan::sockets::ReuseportGroup::~ReuseportGroup() {
+    for (auto& l_handoff: m_handoffs) {
+        if (l_handoff->event != -1) {
+            ::close(l_handoff->event);
+        }
+    }
+}
+
+auto tristan::sockets::ReuseportGroup::accept(uint32_t p_index) -> std::optional< std::unique_ptr< InetSocket > > {
+    if (p_index >= m_listeners.size()) {
+        return std::nullopt;
+    }
+    auto& l_listener = *m_listeners[p_index];
+    while (true) {
+        if (auto l_handed_off = ReuseportGroup::takeHandedOff(p_index)) {
+            return l_handed_off;
+        }
+        if (not l_listener.nonBlocking() && m_handoffs[p_index]->event != -1) {
+            std::array< pollfd, 2 > l_descriptors{
+                {{l_listener.nativeHandle(), POLLIN, 0}, {m_handoffs[p_index]->event, POLLIN, 0}}
+            };
+            auto l_status = ::poll(l_descriptors.data(), l_descriptors.size(), -1);
+            if ((l_status < 0 && errno == EINTR) || (l_status > 0 && l_descriptors[0].revents == 0)) {
+                continue;
+            }
+        }
+        auto l_socket = l_listener.accept();
+        if (not l_socket) {
+            return l_socket;
+        }
+        auto l_cpu = (*l_socket)->incomingCpu();
+        if (l_cpu < 0) {
+            return l_socket;
+        }
+        auto l_owner = static_cast< uint32_t >(l_cpu) % static_cast< uint32_t >(m_listeners.size());
+        if (l_owner == p_index || not ReuseportGroup::handOff(*l_socket, l_owner)) {
+            return l_socket;
+        }
+        ++m_misrouted;
+    }
+}
+
+auto tristan::sockets::ReuseportGroup::handoffHandle(uint32_t p_index) const noexcept -> int32_t {
+    return p_index < m_handoffs.size() ? m_handoffs[p_index]->event : -1;
+}
+
+auto tristan::sockets::ReuseportGroup::listener(uint32_t p_index) -> InetSocket& { return *m_listeners.at(p_index); }
+
+auto tristan::sockets::ReuseportGroup::size() const noexcept -> uint32_t { return static_cast< uint32_t >(m_listeners.size()); }
+
+auto tristan::sockets::ReuseportGroup::steering() const noexcept -> bool { return m_steering; }
+
+auto tristan::sockets::ReuseportGroup::misrouted() const noexcept -> uint64_t { return m_misrouted; }
+
+auto tristan::sockets::ReuseportGroup::error() const noexcept -> std::error_code { return m_error; }
+
+auto tristan::sockets::ReuseportGroup::bindCurrentThread(uint32_t p_cpu) -> bool {
+    cpu_set_t l_cpu_set;
+    CPU_ZERO(&l_cpu_set);
+    CPU_SET(p_cpu, &l_cpu_set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(l_cpu_set), &l_cpu_set) == 0;
+}
+
+void tristan::sockets::ReuseportGroup::attachProgram() {
+    // A = cpu % listener count, returned value is index of the socket in the group
+    std::array< sock_filter, 3 > l_code{
+        {
+         {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast< uint32_t >(SKF_AD_OFF + SKF_AD_CPU)},
+         {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast< uint32_t >(std::max< uint64_t >(m_listeners.size(), 1))},
+         {BPF_RET | BPF_A, 0, 0, 0},
+         }
+    };
+    sock_fprog l_program{static_cast< uint16_t >(l_code.size()), l_code.data()};
+    m_steering = ::setsockopt(m_listeners.front()->nativeHandle(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &l_program, sizeof(l_program)) == 0;
+}
+
+auto tristan::sockets::ReuseportGroup::takeHandedOff(uint32_t p_index) -> std::unique_ptr< InetSocket > {
+    auto& l_handoff = *m_handoffs[p_index];
+    std::lock_guard< std::mutex > l_lock(l_handoff.mutex);
+    if (l_handoff.sockets.empty()) {
+        return nullptr;
+    }
+    auto l_socket = std::move(l_handoff.sockets.front());
+    l_handoff.sockets.pop_front();
+    // Event is read under the lock, so it is readable exactly while the queue is not empty
+    if (l_handoff.sockets.empty()) {
+        eventfd_t l_value;
+        ::eventfd_read(l_handoff.event, &l_value);
+    }
+    return l_socket;
+}
+
+auto tristan::sockets::ReuseportGroup::handOff(std::unique_ptr< InetSocket >& p_socket, uint32_t p_index) -> bool {
+    auto& l_handoff = *m_handoffs[p_index];
+    if (l_handoff.event == -1) {
+        return false;
+    }
+    std::lock_guard< std::mutex > l_lock(l_handoff.mutex);
+    l_handoff.sockets.push_back(std::move(p_socket));
+    ::eventfd_write(l_handoff.event, 1);
+    return true;
+}
@@ -133,6 +133,34 @@ inline const std::map< tristan::sockets::Error, const char* > g_socket_code_desc
     {tristan::sockets::Error::SHUTDOWN_NOT_CONNECTED,                    "The socket is not connected"                                                                               },
     {tristan::sockets::Error::SHUTDOWN_INVALID_FILE_DESCRIPTOR,          "The socket argument does not refer to a socket"                                                            },
     {tristan::sockets::Error::SHUTDOWN_NOT_ENOUGH_MEMORY,                "Insufficient resources were available in the system to perform the operation"                              },
+    {tristan::sockets::Error::FRAME_TOO_LARGE,                           "Frame size exceeds configured maximum"                                                                     },
+    {tristan::sockets::Error::FRAME_MALFORMED_PREFIX,                    "Frame length prefix is malformed"                                                                          },
+    {tristan::sockets::Error::HTTP_MALFORMED_START_LINE,                 "HTTP request or status line is malformed"                                                                  },
+    {tristan::sockets::Error::HTTP_MALFORMED_HEADER,                     "HTTP header line is malformed"                                                                             },
+    {tristan::sockets::Error::HTTP_TOO_MANY_HEADERS,                     "HTTP message contains more headers than supported"                                                         },
+    {tristan::sockets::Error::HTTP_HEAD_TOO_LARGE,                       "HTTP message head exceeds configured maximum"                                                              },
+    {tristan::sockets::Error::HTTP_BODY_TOO_LARGE,                       "HTTP message body exceeds configured maximum"                                                              },
+    {tristan::sockets::Error::HTTP_MALFORMED_CHUNK,                      "HTTP chunked transfer coding is malformed"                                                                 },
+    {tristan::sockets::Error::PIPELINE_WINDOW_FULL,                      "Maximum number of in-flight requests is reached and socket is non blocking"                                },
+    {tristan::sockets::Error::PIPELINE_UNKNOWN_CORRELATION_ID,           "Response correlation id does not match any in-flight request"                                              },
+    {tristan::sockets::Error::PIPELINE_CONNECTION_FAILED,                "Request was not completed because connection failed"                                                       },
+    {tristan::sockets::Error::WEBSOCKET_PROTOCOL_ERROR,                  "WebSocket frame violates the protocol"                                                                     },
+    {tristan::sockets::Error::WEBSOCKET_MESSAGE_TOO_LARGE,               "WebSocket message size exceeds configured maximum"                                                         },
+    {tristan::sockets::Error::WEBSOCKET_CLOSED,                          "WebSocket close frame was already sent"                                                                    },
+    {tristan::sockets::Error::FRAME_CHECKSUM_MISMATCH,                   "Frame checksum does not match its payload"                                                                 },
+    {tristan::sockets::Error::DECOMPRESSION_FAILED,                      "Compressed message is corrupted"                                                                           },
+    {tristan::sockets::Error::COMPRESSION_UNSUPPORTED_ALGORITHM,         "Message is compressed with algorithm which is not configured for the stream"                               },
+    {tristan::sockets::Error::MUX_PROTOCOL_ERROR,                        "Multiplexed connection received malformed frame"                                                           },
+    {tristan::sockets::Error::MUX_FLOW_CONTROL_VIOLATION,                "Peer sent more stream data than flow control window allows"                                                },
+    {tristan::sockets::Error::MUX_STREAM_RESET,                          "Stream was reset"                                                                                          },
+    {tristan::sockets::Error::MUX_STREAM_CLOSED,                         "Sending side of the stream is closed"                                                                      },
+    {tristan::sockets::Error::BATCH_NOT_DATAGRAM_SOCKET,                 "Batch datagram operation was called on stream socket"                                                      },
+    {tristan::sockets::Error::FILE_TRANSFER_WITH_SSL,                    "Kernel side transfer is not possible on SSL connection"                                                    },
+    {tristan::sockets::Error::FILE_TRANSFER_IO_ERROR,                    "File could not be read or written during kernel side transfer"                                             },
+    {tristan::sockets::Error::FILE_TRANSFER_PIPE_ERROR,                  "Pipe for splice could not be created"                                                                      },
+    {tristan::sockets::Error::ENDPOINT_NOT_DATAGRAM_SOCKET,              "Datagram operation with endpoint was called on stream socket"                                              },
+    {tristan::sockets::Error::SOCKET_SET_OPTION_ERROR,                   "Socket option could not be set"                                                                            },
+    {tristan::sockets::Error::PEER_DEAD,                                 "Peer did not respond within keepalive, user timeout or heartbeat limits"                                   },
 };
 
 auto tristan::sockets::makeError(tristan::sockets::Error error_code) -> std::error_code { return {static_cast< int >(error_code), g_socket_error_category}; }
@@ -0,0 +1,222 @@
+#include "socket_error_utility.hpp"
+
+#include <cerrno>
+
+auto tristan::sockets::utility::writeErrorFromErrno(int32_t error_number, bool non_blocking) -> tristan::sockets::Error {
+    switch (error_number) {
+        case EACCES: {
+            return tristan::sockets::Error::WRITE_ACCESS;
+        }
+        case EAGAIN: {
+            if (non_blocking) {
+                return tristan::sockets::Error::WRITE_TRY_AGAIN;
+            }
+            return tristan::sockets::Error::SOCKET_TIMED_OUT;
+        }
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK: {
+            if (non_blocking) {
+                return tristan::sockets::Error::WRITE_TRY_AGAIN;
+            }
+            return tristan::sockets::Error::SOCKET_TIMED_OUT;
+        }
+#endif
+        case EALREADY: {
+            return tristan::sockets::Error::WRITE_ALREADY;
+        }
+        case EBADF: {
+            return tristan::sockets::Error::WRITE_BAD_FILE_DESCRIPTOR;
+        }
+        case ECONNRESET: {
+            return tristan::sockets::Error::WRITE_CONNECTION_RESET;
+        }
+        case EDESTADDRREQ: {
+            return tristan::sockets::Error::WRITE_DESTINATION_ADDRESS;
+        }
+        case EFAULT: {
+            return tristan::sockets::Error::WRITE_BUFFER_OUT_OF_RANGE;
+        }
+        case EINTR: {
+            return tristan::sockets::Error::WRITE_INTERRUPTED;
+        }
+        case EINVAL: {
+            return tristan::sockets::Error::WRITE_INVALID_ARGUMENT;
+        }
+        case EISCONN: {
+            return tristan::sockets::Error::WRITE_IS_CONNECTED;
+        }
+        case EMSGSIZE: {
+            return tristan::sockets::Error::WRITE_MESSAGE_SIZE;
+        }
+        case ENOBUFS: {
+            return tristan::sockets::Error::WRITE_NO_BUFFER;
+        }
+        case ENOMEM: {
+            return tristan::sockets::Error::WRITE_NO_MEMORY;
+        }
+        case ENOTCONN: {
+            return tristan::sockets::Error::WRITE_NOT_CONNECTED;
+        }
+        case ENOTSOCK: {
+            return tristan::sockets::Error::WRITE_NOT_SOCKET;
+        }
+        case EOPNOTSUPP: {
+            return tristan::sockets::Error::WRITE_NOT_SUPPORTED;
+        }
+        case EPIPE: {
+            return tristan::sockets::Error::WRITE_PIPE;
+        }
+        case ETIMEDOUT: {
+            return tristan::sockets::Error::PEER_DEAD;
+        }
+        default: {
+            return tristan::sockets::Error::SUCCESS;
+        }
+    }
+}
+
+auto tristan::sockets::utility::readErrorFromErrno(int32_t error_number, bool non_blocking) -> tristan::sockets::Error {
+    switch (error_number) {
+        case EAGAIN: {
+            if (non_blocking) {
+                return tristan::sockets::Error::READ_TRY_AGAIN;
+            }
+            return tristan::sockets::Error::SOCKET_TIMED_OUT;
+        }
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK: {
+            if (non_blocking) {
+                return tristan::sockets::Error::READ_TRY_AGAIN;
+            }
+            return tristan::sockets::Error::SOCKET_TIMED_OUT;
+        }
+#endif
+        case EBADF: {
+            return tristan::sockets::Error::READ_BAD_FILE_DESCRIPTOR;
+        }
+        case ECONNREFUSED: {
+            return tristan::sockets::Error::READ_CONNECTION_REFUSED;
+        }
+        case EFAULT: {
+            return tristan::sockets::Error::READ_BUFFER_OUT_OF_RANGE;
+        }
+        case EINTR: {
+            return tristan::sockets::Error::READ_INTERRUPTED;
+        }
+        case EINVAL: {
+            return tristan::sockets::Error::READ_INVALID_FILE_DESCRIPTOR;
+        }
+        case ENOMEM: {
+            return tristan::sockets::Error::READ_NO_MEMORY;
+        }
+        case ENOTCONN: {
+            return tristan::sockets::Error::READ_NOT_CONNECTED;
+        }
+        case ENOTSOCK: {
+            return tristan::sockets::Error::READ_NOT_SOCKET;
+        }
+        case ECONNRESET: {
+            return tristan::sockets::Error::READ_CONNECTION_RESET;
+        }
+        case ETIMEDOUT: {
+            return tristan::sockets::Error::PEER_DEAD;
+        }
+        default: {
+            return tristan::sockets::Error::SUCCESS;
+        }
+    }
+}
+
+auto tristan::sockets::utility::connectErrorFromErrno(int32_t error_number, bool non_blocking) -> tristan::sockets::Error {
+    switch (error_number) {
+        case EACCES: {
+            [[fallthrough]];
+        }
+        case EPERM: {
+            return tristan::sockets::Error::CONNECT_NOT_ENOUGH_PERMISSIONS;
+        }
+        case EADDRINUSE: {
+            return tristan::sockets::Error::CONNECT_ADDRESS_IN_USE;
+        }
+        case EADDRNOTAVAIL: {
+            return tristan::sockets::Error::CONNECT_ADDRESS_NOT_AVAILABLE;
+        }
+        case EAFNOSUPPORT: {
+            return tristan::sockets::Error::CONNECT_AF_NOT_SUPPORTED;
+        }
+        case EAGAIN: {
+            if (non_blocking) {
+                return tristan::sockets::Error::CONNECT_TRY_AGAIN;
+            }
+            return tristan::sockets::Error::SOCKET_TIMED_OUT;
+        }
+        case EALREADY: {
+            return tristan::sockets::Error::CONNECT_ALREADY_IN_PROCESS;
+        }
+        case EBADF: {
+            return tristan::sockets::Error::CONNECT_BAD_FILE_DESCRIPTOR;
+        }
+        case ECONNREFUSED: {
+            return tristan::sockets::Error::CONNECT_CONNECTION_REFUSED;
+        }
+        case EFAULT: {
+            return tristan::sockets::Error::CONNECT_ADDRESS_OUTSIDE_USER_SPACE;
+        }
+        case EINPROGRESS: {
+            if (non_blocking) {
+                return tristan::sockets::Error::CONNECT_IN_PROGRESS;
+            }
+            return tristan::sockets::Error::SOCKET_TIMED_OUT;
+        }
+        case EINTR: {
+            return tristan::sockets::Error::CONNECT_INTERRUPTED;
+        }
+        case EISCONN: {
+            return tristan::sockets::Error::CONNECT_CONNECTED;
+        }
+        case ENETUNREACH: {
+            return tristan::sockets::Error::CONNECT_NETWORK_UNREACHABLE;
+        }
+        case ENOTSOCK: {
+            return tristan::sockets::Error::CONNECT_FILE_DESCRIPTOR_IS_NOT_SOCKET;
+        }
+        case EPROTOTYPE: {
+            return tristan::sockets::Error::CONNECT_PROTOCOL_NOT_SUPPORTED;
+        }
+        case ETIMEDOUT: {
+            return tristan::sockets::Error::SOCKET_TIMED_OUT;
+        }
+        default: {
+            return tristan::sockets::Error::SUCCESS;
+        }
+    }
+}
+
+auto tristan::sockets::utility::bindErrorFromErrno(int32_t error_number) -> tristan::sockets::Error {
+    switch (error_number) {
+        case EACCES: {
+            return tristan::sockets::Error::BIND_NOT_ENOUGH_PERMISSIONS;
+        }
+        case EADDRINUSE: {
+            return tristan::sockets::Error::BIND_ADDRESS_IN_USE;
+        }
+        case EADDRNOTAVAIL: {
+            return tristan::sockets::Error::BIND_ADDRESS_NOT_AVAILABLE;
+        }
+        case EBADF: {
+            return tristan::sockets::Error::BIND_BAD_FILE_DESCRIPTOR;
+        }
+        case EFAULT: {
+            return tristan::sockets::Error::BIND_ADDRESS_OUTSIDE_USER_SPACE;
+        }
+        case EINVAL: {
+            return tristan::sockets::Error::BIND_ALREADY_BOUND;
+        }
+        case ENOTSOCK: {
+            return tristan::sockets::Error::BIND_FILE_DESCRIPTOR_IS_NOT_SOCKET;
+        }
+        default: {
+            return tristan::sockets::Error::SUCCESS;
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#include "socket_options.hpp"
+
+#include <algorithm>
+
+auto tristan::sockets::SocketOptions::profile(Profile p_profile) -> SocketOptions {
+    SocketOptions l_options;
+    switch (p_profile) {
+        case Profile::DEFAULT: {
+            break;
+        }
+        case Profile::LOW_LATENCY: {
+            l_options.no_delay = true;
+            l_options.quick_ack = true;
+            l_options.priority = 6;
+            l_options.type_of_service = 0xB8;
+            break;
+        }
+        case Profile::BULK: {
+            l_options.no_delay = false;
+            l_options.quick_ack = false;
+            l_options.type_of_service = 0x28;
+            l_options.send_buffer_size = 4 * 1024 * 1024;
+            l_options.receive_buffer_size = 4 * 1024 * 1024;
+            break;
+        }
+        case Profile::CONNECTION_CHURN: {
+            l_options.no_delay = true;
+            l_options.abortive_close = true;
+            l_options.bind_address_no_port = true;
+            break;
+        }
+    }
+    return l_options;
+}
+
+void tristan::sockets::SocketOptions::setLiveness(std::chrono::seconds p_detection_time) {
+    // Idle connection is dropped after idle time plus count probe intervals, both add up to detection time
+    auto l_detection_time = std::max(p_detection_time, std::chrono::seconds(3));
+    keep_alive = true;
+    keep_alive_count = 3;
+    keep_alive_interval = std::max(l_detection_time / 6, std::chrono::seconds(1));
+    keep_alive_idle = std::max(l_detection_time - *keep_alive_interval * *keep_alive_count, std::chrono::seconds(1));
+    user_timeout = l_detection_time;
+}
@@ -0,0 +1,97 @@
+#include "source_address_pool.hpp"
+#include "socket_error.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+    constexpr uint32_t time_wait_state = 0x06;
+    constexpr uint32_t listen_state = 0x0A;
+
+}  // namespace
+
+tristan::sockets::SourceAddressPool::SourceAddressPool(std::vector< uint32_t > p_ips) :
+    m_ips(std::move(p_ips)),
+    m_next(0),
+    m_connections(0),
+    m_exhausted(0) { }
+
+void tristan::sockets::SourceAddressPool::connect(InetSocket& p_socket, bool p_ssl) {
+    if (p_socket.error()) {
+        return;
+    }
+    if (not m_ips.empty()) {
+        if (not p_socket.options().bind_address_no_port.value_or(false)) {
+            auto l_options = p_socket.options();
+            l_options.bind_address_no_port = true;
+            p_socket.setOptions(l_options);
+            if (p_socket.error()) {
+                return;
+            }
+        }
+        p_socket.bindSource(SourceAddressPool::next());
+        if (p_socket.error()) {
+            return;
+        }
+    }
+    p_socket.connect(p_ssl);
+    auto l_error = p_socket.error();
+    if (l_error == tristan::sockets::makeError(tristan::sockets::Error::CONNECT_ADDRESS_NOT_AVAILABLE)) {
+        ++m_exhausted;
+    } else if (not l_error || l_error == tristan::sockets::makeError(tristan::sockets::Error::CONNECT_IN_PROGRESS)) {
+        ++m_connections;
+    }
+}
+
+auto tristan::sockets::SourceAddressPool::next() -> uint32_t {
+    if (m_ips.empty()) {
+        return 0;
+    }
+    return m_ips[m_next++ % m_ips.size()];
+}
+
+auto tristan::sockets::SourceAddressPool::size() const noexcept -> uint64_t { return m_ips.size(); }
+
+auto tristan::sockets::SourceAddressPool::statistics() const -> Statistics {
+    Statistics l_statistics;
+    l_statistics.connections = m_connections;
+    l_statistics.exhausted = m_exhausted;
+
+    std::ifstream l_range("/proc/sys/net/ipv4/ip_local_port_range");
+    uint32_t l_begin = 0;
+    uint32_t l_end = 0;
+    if (l_range >> l_begin >> l_end) {
+        l_statistics.port_range_begin = static_cast< uint16_t >(l_begin);
+        l_statistics.port_range_end = static_cast< uint16_t >(l_end);
+    }
+
+    // Lines look like "0: 0100007F:A2C4 0100007F:1F90 06 ...", address is printed as stored, so it compares with IP in network byte order
+    std::ifstream l_table("/proc/net/tcp");
+    std::string l_line;
+    std::getline(l_table, l_line);
+    while (std::getline(l_table, l_line)) {
+        std::istringstream l_fields(l_line);
+        std::string l_slot;
+        std::string l_local;
+        std::string l_remote;
+        std::string l_state;
+        if (not(l_fields >> l_slot >> l_local >> l_remote >> l_state) || l_local.size() != 13) {
+            continue;
+        }
+        auto l_ip = static_cast< uint32_t >(std::stoul(l_local.substr(0, 8), nullptr, 16));
+        auto l_port = static_cast< uint32_t >(std::stoul(l_local.substr(9), nullptr, 16));
+        auto l_state_value = static_cast< uint32_t >(std::stoul(l_state, nullptr, 16));
+        if (std::find(m_ips.begin(), m_ips.end(), l_ip) == m_ips.end() || l_port < l_begin || l_port > l_end || l_state_value == listen_state) {
+            continue;
+        }
+        if (l_state_value == time_wait_state) {
+            ++l_statistics.time_wait;
+        } else {
+            ++l_statistics.ports_in_use;
+        }
+    }
+    return l_statistics;
+}
@@ -0,0 +1,299 @@
+#include "splice_relay.hpp"
+#include "pipe_signal_utility.hpp"
+#include "socket_error_utility.hpp"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+namespace {
+
+    auto createPipe(std::array< int32_t, 2 >& p_pipe, uint64_t p_size) -> uint64_t {
+        if (::pipe2(p_pipe.data(), O_CLOEXEC | O_NONBLOCK) < 0) {
+            p_pipe = {-1, -1};
+            return 0;
+        }
+        ::fcntl(p_pipe[1], F_SETPIPE_SZ, static_cast< int32_t >(p_size));
+        auto l_capacity = ::fcntl(p_pipe[1], F_GETPIPE_SZ);
+        return l_capacity > 0 ? static_cast< uint64_t >(l_capacity) : 64 * 1024;
+    }
+
+    void closePipe(std::array< int32_t, 2 >& p_pipe) {
+        if (p_pipe[0] != -1) {
+            ::close(p_pipe[0]);
+            ::close(p_pipe[1]);
+            p_pipe = {-1, -1};
+        }
+    }
+
+    auto spliceWithoutSignal(int32_t p_pipe, int32_t p_socket, uint64_t p_size) -> ssize_t {
+        return tristan::sockets::utility::withoutPipeSignal([&] {
+            return ::splice(p_pipe, nullptr, p_socket, nullptr, p_size, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        });
+    }
+
+    auto teeWithoutSignal(int32_t p_input, int32_t p_output, uint64_t p_size) -> ssize_t {
+        return tristan::sockets::utility::withoutPipeSignal([&] {
+            return ::tee(p_input, p_output, p_size, SPLICE_F_NONBLOCK);
+        });
+    }
+
+}  // namespace
+
+tristan::sockets::SpliceRelay::~SpliceRelay() {
+    for (auto& l_direction: m_directions) {
+        closePipe(l_direction.pipe);
+        closePipe(l_direction.staging_pipe);
+    }
+    closePipe(m_mirror.pipe);
+}
+
+auto tristan::sockets::SpliceRelay::poll() -> uint64_t {
+    if (m_finished) {
+        return 0;
+    }
+    uint64_t l_delivered = 0;
+    for (uint8_t i = 0; i < 2 && not m_error; ++i) {
+        l_delivered += SpliceRelay::pump(m_directions[i], m_mirror.active && m_mirror.direction == i);
+    }
+    if (m_mirror.active && not m_error) {
+        SpliceRelay::pumpMirror();
+    }
+    m_finished = m_error || (m_directions[0].destination_shut_down && m_directions[1].destination_shut_down);
+    if (m_finished && m_mirror.active) {
+        // Relay is not pumped any more, so data which shadow did not take yet is lost
+        if (not m_mirror.shut_down) {
+            ::shutdown(m_mirror.shadow, SHUT_WR);
+            m_mirror.shut_down = true;
+        }
+        SpliceRelay::stopMirror(m_mirror_error);
+    }
+    return l_delivered;
+}
+
+auto tristan::sockets::SpliceRelay::run(std::chrono::milliseconds p_idle_timeout) -> uint64_t {
+    uint64_t l_delivered = SpliceRelay::poll();
+    while (not m_finished) {
+        std::array< pollfd, 3 > l_descriptors{
+            pollfd{m_directions[0].source, 0, 0},
+            pollfd{m_directions[1].source, 0, 0},
+            pollfd{m_mirror.shadow, POLLIN, 0}
+        };
+        for (uint8_t i = 0; i < 2; ++i) {
+            const auto& l_direction = m_directions[i];
+            if (not l_direction.source_finished && l_direction.bytes_in_pipe < l_direction.pipe_capacity) {
+                l_descriptors[i].events |= POLLIN;
+            }
+            if (l_direction.bytes_in_pipe + l_direction.bytes_in_staging_pipe > 0) {
+                l_descriptors[1 - i].events |= POLLOUT;
+            }
+        }
+        if (m_mirror.bytes_in_pipe > 0) {
+            l_descriptors[2].events |= POLLOUT;
+        }
+        // Shadow which closed its side has nothing to read, and once it is shut down here too it reports POLLHUP on every call
+        if (m_mirror.peer_closed) {
+            l_descriptors[2].events &= ~POLLIN;
+            if (l_descriptors[2].events == 0) {
+                l_descriptors[2].fd = -1;
+            }
+        }
+        auto l_descriptor_count = m_mirror.active ? 3 : 2;
+        auto l_status = ::poll(l_descriptors.data(), l_descriptor_count, static_cast< int32_t >(p_idle_timeout.count()));
+        if (l_status < 0 && errno != EINTR) {
+            m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, true));
+            m_finished = true;
+            break;
+        }
+        if (l_status == 0) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_TIMED_OUT);
+            break;
+        }
+        l_delivered += SpliceRelay::poll();
+    }
+    return l_delivered;
+}
+
+auto tristan::sockets::SpliceRelay::bytesFirstToSecond() const noexcept -> uint64_t { return m_directions[0].bytes_delivered; }
+
+auto tristan::sockets::SpliceRelay::bytesSecondToFirst() const noexcept -> uint64_t { return m_directions[1].bytes_delivered; }
+
+auto tristan::sockets::SpliceRelay::bytesMirrored() const noexcept -> uint64_t { return m_mirror.bytes_delivered; }
+
+auto tristan::sockets::SpliceRelay::bytesMirrorDropped() const noexcept -> uint64_t { return m_mirror.bytes_dropped; }
+
+auto tristan::sockets::SpliceRelay::mirrorError() const noexcept -> std::error_code { return m_mirror_error; }
+
+auto tristan::sockets::SpliceRelay::finished() const noexcept -> bool { return m_finished; }
+
+auto tristan::sockets::SpliceRelay::error() const noexcept -> std::error_code { return m_error; }
+
+void tristan::sockets::SpliceRelay::init(int32_t p_first, int32_t p_second, uint64_t p_pipe_size) {
+    m_directions[0].source = p_first;
+    m_directions[0].destination = p_second;
+    m_directions[1].source = p_second;
+    m_directions[1].destination = p_first;
+    if (m_error) {
+        m_finished = true;
+        return;
+    }
+    if (p_first == -1 || p_second == -1) {
+        m_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        m_finished = true;
+        return;
+    }
+    for (auto& l_direction: m_directions) {
+        l_direction.pipe_capacity = createPipe(l_direction.pipe, p_pipe_size);
+        if (l_direction.pipe_capacity == 0) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::FILE_TRANSFER_PIPE_ERROR);
+            m_finished = true;
+            return;
+        }
+    }
+}
+
+void tristan::sockets::SpliceRelay::initMirror(int32_t p_shadow, RelayDirection p_direction) {
+    if (m_mirror.active || m_finished) {
+        return;
+    }
+    if (p_shadow == -1) {
+        m_mirror_error = tristan::sockets::makeError(tristan::sockets::Error::SOCKET_NOT_INITIALISED);
+        return;
+    }
+    auto& l_direction = m_directions[static_cast< uint8_t >(p_direction)];
+    if (createPipe(l_direction.staging_pipe, l_direction.pipe_capacity) == 0 || createPipe(m_mirror.pipe, l_direction.pipe_capacity) == 0) {
+        closePipe(l_direction.staging_pipe);
+        m_mirror_error = tristan::sockets::makeError(tristan::sockets::Error::FILE_TRANSFER_PIPE_ERROR);
+        return;
+    }
+    m_mirror.shadow = p_shadow;
+    m_mirror.direction = static_cast< uint8_t >(p_direction);
+    m_mirror.active = true;
+}
+
+auto tristan::sockets::SpliceRelay::pump(Direction& p_direction, bool p_mirrored) -> uint64_t {
+    uint64_t l_delivered = 0;
+    bool l_progress = true;
+    while (l_progress) {
+        l_progress = false;
+        if (p_direction.bytes_in_staging_pipe > 0) {
+            auto l_status = ::splice(p_direction.staging_pipe[0],
+                                     nullptr,
+                                     p_direction.pipe[1],
+                                     nullptr,
+                                     p_direction.bytes_in_staging_pipe,
+                                     SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+            if (l_status > 0) {
+                p_direction.bytes_in_staging_pipe -= static_cast< uint64_t >(l_status);
+                p_direction.bytes_in_pipe += static_cast< uint64_t >(l_status);
+                l_progress = true;
+            }
+        } else if (p_mirrored && not p_direction.source_finished && p_direction.bytes_in_pipe < p_direction.pipe_capacity) {
+            // Staging pipe is empty, so everything spliced into it is new data which is duplicated to the mirror pipe as a whole
+            auto l_status = ::splice(p_direction.source,
+                                     nullptr,
+                                     p_direction.staging_pipe[1],
+                                     nullptr,
+                                     p_direction.pipe_capacity - p_direction.bytes_in_pipe,
+                                     SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+            if (l_status > 0) {
+                auto l_size = static_cast< uint64_t >(l_status);
+                p_direction.bytes_in_staging_pipe = l_size;
+                uint64_t l_mirrored = 0;
+                if (m_mirror.active) {
+                    auto l_teed = teeWithoutSignal(p_direction.staging_pipe[0], m_mirror.pipe[1], l_size);
+                    l_mirrored = l_teed > 0 ? static_cast< uint64_t >(l_teed) : 0;
+                }
+                m_mirror.bytes_in_pipe += l_mirrored;
+                m_mirror.bytes_dropped += l_size - l_mirrored;
+                l_progress = true;
+            } else if (l_status == 0) {
+                p_direction.source_finished = true;
+            } else if (errno != EAGAIN && errno != EINTR) {
+                m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, true));
+                return l_delivered;
+            }
+        } else if (not p_mirrored && not p_direction.source_finished && p_direction.bytes_in_pipe < p_direction.pipe_capacity) {
+            auto l_status = ::splice(p_direction.source,
+                                     nullptr,
+                                     p_direction.pipe[1],
+                                     nullptr,
+                                     p_direction.pipe_capacity - p_direction.bytes_in_pipe,
+                                     SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+            if (l_status > 0) {
+                p_direction.bytes_in_pipe += static_cast< uint64_t >(l_status);
+                l_progress = true;
+            } else if (l_status == 0) {
+                p_direction.source_finished = true;
+            } else if (errno != EAGAIN && errno != EINTR) {
+                m_error = tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, true));
+                return l_delivered;
+            }
+        }
+        if (p_direction.bytes_in_pipe > 0) {
+            auto l_status = spliceWithoutSignal(p_direction.pipe[0], p_direction.destination, p_direction.bytes_in_pipe);
+            if (l_status > 0) {
+                p_direction.bytes_in_pipe -= static_cast< uint64_t >(l_status);
+                p_direction.bytes_delivered += static_cast< uint64_t >(l_status);
+                l_delivered += static_cast< uint64_t >(l_status);
+                l_progress = true;
+            } else if (l_status < 0 && errno != EAGAIN && errno != EINTR) {
+                m_error = tristan::sockets::makeError(tristan::sockets::utility::writeErrorFromErrno(errno, true));
+                return l_delivered;
+            }
+        }
+    }
+    if (p_direction.source_finished && p_direction.bytes_in_pipe == 0 && p_direction.bytes_in_staging_pipe == 0 && not p_direction.destination_shut_down) {
+        ::shutdown(p_direction.destination, SHUT_WR);
+        p_direction.destination_shut_down = true;
+    }
+    return l_delivered;
+}
+
+void tristan::sockets::SpliceRelay::pumpMirror() {
+    while (m_mirror.bytes_in_pipe > 0) {
+        auto l_status = spliceWithoutSignal(m_mirror.pipe[0], m_mirror.shadow, m_mirror.bytes_in_pipe);
+        if (l_status > 0) {
+            m_mirror.bytes_in_pipe -= static_cast< uint64_t >(l_status);
+            m_mirror.bytes_delivered += static_cast< uint64_t >(l_status);
+            continue;
+        }
+        if (l_status < 0 && errno != EAGAIN && errno != EINTR) {
+            SpliceRelay::stopMirror(tristan::sockets::makeError(tristan::sockets::utility::writeErrorFromErrno(errno, true)));
+            return;
+        }
+        break;
+    }
+    uint8_t l_discarded[4096];
+    while (not m_mirror.peer_closed) {
+        auto l_status = ::recv(m_mirror.shadow, l_discarded, sizeof(l_discarded), MSG_DONTWAIT);
+        if (l_status > 0) {
+            continue;
+        }
+        if (l_status == 0) {
+            m_mirror.peer_closed = true;
+            break;
+        }
+        if (l_status < 0 && errno != EAGAIN && errno != EINTR) {
+            SpliceRelay::stopMirror(tristan::sockets::makeError(tristan::sockets::utility::readErrorFromErrno(errno, true)));
+            return;
+        }
+        break;
+    }
+    const auto& l_direction = m_directions[m_mirror.direction];
+    if (l_direction.source_finished && l_direction.bytes_in_staging_pipe == 0 && m_mirror.bytes_in_pipe == 0 && not m_mirror.shut_down) {
+        ::shutdown(m_mirror.shadow, SHUT_WR);
+        m_mirror.shut_down = true;
+    }
+}
+
+void tristan::sockets::SpliceRelay::stopMirror(std::error_code p_error) {
+    m_mirror_error = p_error;
+    m_mirror.active = false;
+    m_mirror.bytes_dropped += m_mirror.bytes_in_pipe;
+    m_mirror.bytes_in_pipe = 0;
+    closePipe(m_mirror.pipe);
+}
@@ -5,6 +5,8 @@
 #include <openssl/x509v3.h>
 #include <openssl/ssl.h>
 
+#include <cerrno>
+
 tristan::sockets::Ssl::Ssl(int32_t socket) :
     m_context(nullptr),
     m_ssl(nullptr),
@@ -155,7 +157,7 @@ auto tristan::sockets::Ssl::write(uint8_t byte) -> std::pair< std::error_code, u
                 break;
             }
             case SSL_ERROR_SYSCALL: {
-                error_code = tristan::sockets::makeError(tristan::sockets::Error::SSL_IO_ERROR);
+                error_code = tristan::sockets::makeError(errno == ETIMEDOUT ? tristan::sockets::Error::PEER_DEAD : tristan::sockets::Error::SSL_IO_ERROR);
                 break;
             }
             case SSL_ERROR_SSL: {
@@ -171,9 +173,13 @@ auto tristan::sockets::Ssl::write(uint8_t byte) -> std::pair< std::error_code, u
 }
 
 auto tristan::sockets::Ssl::write(const std::vector< uint8_t >& data, uint16_t size, uint64_t offset) -> std::pair< std::error_code, uint64_t > {
+    return Ssl::write(data.data() + offset, size);
+}
+
+auto tristan::sockets::Ssl::write(const uint8_t* data, uint64_t size) -> std::pair< std::error_code, uint64_t > {
     uint64_t bytes_writen = 0;
     std::error_code error_code;
-    auto status = SSL_write_ex(m_ssl, data.data() + offset, size, &bytes_writen);
+    auto status = SSL_write_ex(m_ssl, data, size, &bytes_writen);
     if (status <= 0) {
         int32_t error = SSL_get_error(m_ssl, status);
         switch (error) {
@@ -192,7 +198,7 @@ auto tristan::sockets::Ssl::write(const std::vector< uint8_t >& data, uint16_t s
                 break;
             }
             case SSL_ERROR_SYSCALL: {
-                error_code = tristan::sockets::makeError(tristan::sockets::Error::SSL_IO_ERROR);
+                error_code = tristan::sockets::makeError(errno == ETIMEDOUT ? tristan::sockets::Error::PEER_DEAD : tristan::sockets::Error::SSL_IO_ERROR);
                 break;
             }
             case SSL_ERROR_SSL: {
@@ -230,7 +236,7 @@ auto tristan::sockets::Ssl::read() -> std::pair< std::error_code, uint8_t > {
                 break;
             }
             case SSL_ERROR_SYSCALL: {
-                error_code = tristan::sockets::makeError(tristan::sockets::Error::SSL_IO_ERROR);
+                error_code = tristan::sockets::makeError(errno == ETIMEDOUT ? tristan::sockets::Error::PEER_DEAD : tristan::sockets::Error::SSL_IO_ERROR);
                 break;
             }
             case SSL_ERROR_SSL: {
@@ -251,11 +257,42 @@ auto tristan::sockets::Ssl::read(std::vector<uint8_t>& data, uint16_t size) -> s
     }
 
     data.resize(size);
+
+    auto [error_code, bytes_read] = Ssl::read(data.data(), size);
+
+    if (data.size() != bytes_read) {
+        data.resize(bytes_read);
+    }
+
+    return {error_code, data};
+}
+
+auto tristan::sockets::Ssl::read(std::pmr::vector<uint8_t>& data, uint16_t size) -> std::pair< std::error_code, uint64_t > {
+    if (size == 0) {
+        return {{}, 0};
+    }
+
+    data.resize(size);
+
+    auto [error_code, bytes_read] = Ssl::read(data.data(), size);
+
+    if (data.size() != bytes_read) {
+        data.resize(bytes_read);
+    }
+
+    return {error_code, bytes_read};
+}
+
+auto tristan::sockets::Ssl::read(uint8_t* data, uint64_t size) -> std::pair< std::error_code, uint64_t > {
+    if (size == 0) {
+        return {{}, 0};
+    }
+
     std::error_code error_code;
 
     uint64_t bytes_read = 0;
 
-    auto status = SSL_read_ex(m_ssl, data.data(), size, &bytes_read);
+    auto status = SSL_read_ex(m_ssl, data, size, &bytes_read);
 
     if (status <= 0) {
         int32_t error = SSL_get_error(m_ssl, status);
@@ -275,7 +312,7 @@ auto tristan::sockets::Ssl::read(std::vector<uint8_t>& data, uint16_t size) -> s
                 break;
             }
             case SSL_ERROR_SYSCALL: {
-                error_code = tristan::sockets::makeError(tristan::sockets::Error::SSL_IO_ERROR);
+                error_code = tristan::sockets::makeError(errno == ETIMEDOUT ? tristan::sockets::Error::PEER_DEAD : tristan::sockets::Error::SSL_IO_ERROR);
                 break;
             }
             case SSL_ERROR_SSL: {
@@ -288,11 +325,7 @@ auto tristan::sockets::Ssl::read(std::vector<uint8_t>& data, uint16_t size) -> s
         }
     }
 
-    if (data.size() != bytes_read) {
-        data.resize(bytes_read);
-    }
-
-    return {error_code, data};
+    return {error_code, bytes_read};
 }
 
 void tristan::sockets::Ssl::shutdown() { SSL_shutdown(m_ssl); }
@@ -0,0 +1,210 @@
+#include "websocket.hpp"
+
+#if defined(__SSE2__)
+  #include <immintrin.h>
+#endif
+
+namespace {
+
+    void maskCopy(const uint8_t* p_source, uint8_t* p_destination, uint64_t p_size, std::array< uint8_t, 4 > p_key, uint64_t p_offset) noexcept {
+        uint8_t l_rotated[4];
+        for (uint8_t i = 0; i < 4; ++i) {
+            l_rotated[i] = p_key[(p_offset + i) % 4];
+        }
+        uint32_t l_key_32;
+        std::memcpy(&l_key_32, l_rotated, sizeof(l_key_32));
+        uint64_t l_index = 0;
+#if defined(__AVX2__)
+        const __m256i l_key_256 = _mm256_set1_epi32(static_cast< int32_t >(l_key_32));
+        for (; l_index + 32 <= p_size; l_index += 32) {
+            auto l_chunk = _mm256_loadu_si256(reinterpret_cast< const __m256i* >(p_source + l_index));
+            _mm256_storeu_si256(reinterpret_cast< __m256i* >(p_destination + l_index), _mm256_xor_si256(l_chunk, l_key_256));
+        }
+#endif
+#if defined(__SSE2__)
+        const __m128i l_key_128 = _mm_set1_epi32(static_cast< int32_t >(l_key_32));
+        for (; l_index + 16 <= p_size; l_index += 16) {
+            auto l_chunk = _mm_loadu_si128(reinterpret_cast< const __m128i* >(p_source + l_index));
+            _mm_storeu_si128(reinterpret_cast< __m128i* >(p_destination + l_index), _mm_xor_si128(l_chunk, l_key_128));
+        }
+#endif
+        const uint64_t l_key_64 = static_cast< uint64_t >(l_key_32) << 32 | l_key_32;
+        for (; l_index + 8 <= p_size; l_index += 8) {
+            uint64_t l_word;
+            std::memcpy(&l_word, p_source + l_index, sizeof(l_word));
+            l_word ^= l_key_64;
+            std::memcpy(p_destination + l_index, &l_word, sizeof(l_word));
+        }
+        for (; l_index < p_size; ++l_index) {
+            p_destination[l_index] = p_source[l_index] ^ l_rotated[l_index % 4];
+        }
+    }
+
+    [[nodiscard]] auto validOpcode(uint8_t p_opcode) noexcept -> bool { return p_opcode <= 0x2 || (p_opcode >= 0x8 && p_opcode <= 0xA); }
+
+}  // namespace
+
+void tristan::sockets::WebSocketCodec::applyMask(std::span< uint8_t > p_data, std::array< uint8_t, 4 > p_key, uint64_t p_offset) noexcept {
+    maskCopy(p_data.data(), p_data.data(), p_data.size(), p_key, p_offset);
+}
+
+void tristan::sockets::WebSocketCodec::copyMasked(std::span< const uint8_t > p_source, uint8_t* p_destination, std::array< uint8_t, 4 > p_key, uint64_t p_offset) noexcept {
+    maskCopy(p_source.data(), p_destination, p_source.size(), p_key, p_offset);
+}
+
+auto tristan::sockets::WebSocketCodec::encodeHeader(WebSocketOpcode p_opcode, bool p_fin, uint64_t p_payload_size, const std::array< uint8_t, 4 >* p_key, uint8_t* p_destination) noexcept
+    -> uint8_t {
+    p_destination[0] = static_cast< uint8_t >((p_fin ? 0x80 : 0x00) | static_cast< uint8_t >(p_opcode));
+    uint8_t l_mask_bit = p_key != nullptr ? 0x80 : 0x00;
+    uint8_t l_header_size = 2;
+    if (p_payload_size < 126) {
+        p_destination[1] = static_cast< uint8_t >(l_mask_bit | p_payload_size);
+    } else if (p_payload_size <= 0xFFFF) {
+        p_destination[1] = static_cast< uint8_t >(l_mask_bit | 126);
+        p_destination[2] = static_cast< uint8_t >(p_payload_size >> 8);
+        p_destination[3] = static_cast< uint8_t >(p_payload_size);
+        l_header_size = 4;
+    } else {
+        p_destination[1] = static_cast< uint8_t >(l_mask_bit | 127);
+        for (uint8_t i = 0; i < 8; ++i) {
+            p_destination[9 - i] = static_cast< uint8_t >(p_payload_size >> (i * 8));
+        }
+        l_header_size = 10;
+    }
+    if (p_key != nullptr) {
+        std::memcpy(p_destination + l_header_size, p_key->data(), 4);
+        l_header_size += 4;
+    }
+    return l_header_size;
+}
+
+tristan::sockets::WebSocketParser::WebSocketParser(WebSocketRole p_role, uint64_t p_max_message_size, uint64_t p_buffer_size) :
+    m_buffer(p_buffer_size),
+    m_max_message_size(p_max_message_size),
+    m_begin(0),
+    m_end(0),
+    m_message_begin(0),
+    m_message_size(0),
+    m_pending_frame_size(0),
+    m_message_opcode(WebSocketOpcode::BINARY),
+    m_role(p_role),
+    m_fragmented(false) { }
+
+auto tristan::sockets::WebSocketParser::receiveSpace() -> std::span< uint8_t > {
+    uint64_t l_kept = 0;
+    if (m_fragmented) {
+        if (m_message_begin > 0 && m_message_size > 0) {
+            std::memmove(m_buffer.data(), m_buffer.data() + m_message_begin, m_message_size);
+        }
+        m_message_begin = 0;
+        l_kept = m_message_size;
+    }
+    if (m_begin > l_kept) {
+        if (m_end > m_begin) {
+            std::memmove(m_buffer.data() + l_kept, m_buffer.data() + m_begin, m_end - m_begin);
+        }
+        m_end -= m_begin - l_kept;
+        m_begin = l_kept;
+    }
+    if (m_begin + m_pending_frame_size > m_buffer.size()) {
+        m_buffer.resize(m_begin + m_pending_frame_size);
+    } else if (m_end == m_buffer.size()) {
+        m_buffer.resize(m_buffer.empty() ? WebSocketCodec::max_header_size : m_buffer.size() * 2);
+    }
+    return {m_buffer.data() + m_end, m_buffer.size() - m_end};
+}
+
+void tristan::sockets::WebSocketParser::commit(uint64_t p_size) { m_end += std::min< uint64_t >(p_size, m_buffer.size() - m_end); }
+
+auto tristan::sockets::WebSocketParser::next() -> std::optional< WebSocketMessage > {
+    m_pending_frame_size = 0;
+    while (not m_error && m_end - m_begin >= 2) {
+        auto l_available = m_end - m_begin;
+        auto* l_frame = m_buffer.data() + m_begin;
+
+        bool l_fin = (l_frame[0] & 0x80) != 0;
+        auto l_opcode = static_cast< uint8_t >(l_frame[0] & 0x0F);
+        bool l_masked = (l_frame[1] & 0x80) != 0;
+        bool l_control = (l_opcode & 0x8) != 0;
+        if ((l_frame[0] & 0x70) != 0 || not validOpcode(l_opcode) || l_masked != (m_role == WebSocketRole::SERVER)) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::WEBSOCKET_PROTOCOL_ERROR);
+            break;
+        }
+
+        uint64_t l_header_size = 2;
+        uint64_t l_payload_size = l_frame[1] & 0x7F;
+        if (l_payload_size == 126) {
+            l_header_size += 2;
+        } else if (l_payload_size == 127) {
+            l_header_size += 8;
+        }
+        if (l_masked) {
+            l_header_size += 4;
+        }
+        if (l_available < l_header_size) {
+            break;
+        }
+        if (l_payload_size == 126) {
+            l_payload_size = static_cast< uint64_t >(l_frame[2]) << 8 | l_frame[3];
+        } else if (l_payload_size == 127) {
+            l_payload_size = 0;
+            for (uint8_t i = 0; i < 8; ++i) {
+                l_payload_size = (l_payload_size << 8) | l_frame[2 + i];
+            }
+            if (l_payload_size >> 63 != 0) {
+                m_error = tristan::sockets::makeError(tristan::sockets::Error::WEBSOCKET_PROTOCOL_ERROR);
+                break;
+            }
+        }
+        if (l_control && (not l_fin || l_payload_size > 125)) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::WEBSOCKET_PROTOCOL_ERROR);
+            break;
+        }
+        if (not l_control && (m_fragmented ? m_message_size : 0) + l_payload_size > m_max_message_size) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::WEBSOCKET_MESSAGE_TOO_LARGE);
+            break;
+        }
+        if (not l_control && (l_opcode == static_cast< uint8_t >(WebSocketOpcode::CONTINUATION)) != m_fragmented) {
+            m_error = tristan::sockets::makeError(tristan::sockets::Error::WEBSOCKET_PROTOCOL_ERROR);
+            break;
+        }
+        if (l_header_size + l_payload_size > l_available) {
+            m_pending_frame_size = l_header_size + l_payload_size;
+            break;
+        }
+
+        auto l_payload_begin = m_begin + l_header_size;
+        if (l_masked) {
+            std::array< uint8_t, 4 > l_key{l_frame[l_header_size - 4], l_frame[l_header_size - 3], l_frame[l_header_size - 2], l_frame[l_header_size - 1]};
+            WebSocketCodec::applyMask({m_buffer.data() + l_payload_begin, l_payload_size}, l_key);
+        }
+        m_begin = l_payload_begin + l_payload_size;
+
+        if (l_control) {
+            return WebSocketMessage{static_cast< WebSocketOpcode >(l_opcode), {m_buffer.data() + l_payload_begin, l_payload_size}};
+        }
+        if (not m_fragmented) {
+            if (l_fin) {
+                return WebSocketMessage{static_cast< WebSocketOpcode >(l_opcode), {m_buffer.data() + l_payload_begin, l_payload_size}};
+            }
+            m_fragmented = true;
+            m_message_opcode = static_cast< WebSocketOpcode >(l_opcode);
+            m_message_begin = l_payload_begin;
+            m_message_size = l_payload_size;
+            continue;
+        }
+        if (l_payload_size > 0) {
+            std::memmove(m_buffer.data() + m_message_begin + m_message_size, m_buffer.data() + l_payload_begin, l_payload_size);
+        }
+        m_message_size += l_payload_size;
+        if (l_fin) {
+            m_fragmented = false;
+            return WebSocketMessage{m_message_opcode, {m_buffer.data() + m_message_begin, m_message_size}};
+        }
+    }
+    return std::nullopt;
+}
+
+auto tristan::sockets::WebSocketParser::pendingFrameSize() const noexcept -> uint64_t { return m_pending_frame_size; }
+
+auto tristan::sockets::WebSocketParser::error() const noexcept -> std::error_code { return m_error; }